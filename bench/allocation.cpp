@@ -0,0 +1,97 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+#include "zelix/memory/arena.h"
+#include "zelix/memory/monotonic.h"
+#include "zelix/memory/system_resource.h"
+#include "zelix/memory/thread_cache.h"
+
+using namespace zelix::stl;
+
+/// A typical tree or list node
+struct bench_node
+{
+    uint64_t key;
+    uint64_t value;
+    bench_node *left = nullptr;
+    bench_node *right = nullptr;
+
+    explicit bench_node(const uint64_t k) : key(k), value(k) {}
+};
+
+/// Allocates a batch of nodes and frees them again, the way a container churns
+template <typename Resource>
+static void BM_allocate_free(benchmark::State &state)
+{
+    const auto batch = static_cast<size_t>(state.range(0));
+    auto **nodes = new bench_node *[batch];
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch; ++i) nodes[i] = Resource::allocate(i);
+        benchmark::ClobberMemory();
+        for (size_t i = 0; i < batch; ++i) Resource::deallocate(nodes[i]);
+    }
+
+    delete[] nodes;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch));
+}
+
+#define ZELIX_BENCH_ALLOC(resource) \
+    BENCHMARK_TEMPLATE(BM_allocate_free, resource)->RangeMultiplier(16)->Range(16, 1 << 14)->ThreadRange(1, 8)
+
+ZELIX_BENCH_ALLOC(memory::system_resource<bench_node>);
+ZELIX_BENCH_ALLOC(memory::thread_cached_resource<bench_node>);
+ZELIX_BENCH_ALLOC(memory::tl_monotonic_resource<bench_node>);
+ZELIX_BENCH_ALLOC(memory::concurrent_monotonic_resource<bench_node>);
+
+// Shares one free list between threads, so only measured single-threaded
+BENCHMARK_TEMPLATE(BM_allocate_free, memory::monotonic_resource<bench_node>)->RangeMultiplier(16)->Range(16, 1 << 14);
+
+/// Bump allocation with everything released by rewinding the arena
+static void BM_arena_scope(benchmark::State &state)
+{
+    const auto batch = static_cast<size_t>(state.range(0));
+    auto &arena = memory::thread_arena();
+
+    for (auto _ : state)
+    {
+        memory::arena::scope scope(arena);
+        for (size_t i = 0; i < batch; ++i)
+        {
+            benchmark::DoNotOptimize(memory::arena_resource<bench_node>::allocate(i));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch));
+}
+BENCHMARK(BM_arena_scope)->RangeMultiplier(16)->Range(16, 1 << 14)->ThreadRange(1, 8);
@@ -0,0 +1,348 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <list>
+#include <map>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "zelix/hash_map.h"
+#include "zelix/list.h"
+#include "zelix/map.h"
+#include "zelix/ring_buffer.h"
+#include "zelix/set.h"
+#include "zelix/vector.h"
+
+using namespace zelix;
+
+// Every benchmark runs at these element counts so growth and cache effects show up
+#define ZELIX_BENCH_SIZES RangeMultiplier(16)->Range(16, 1 << 20)
+
+/// Keys in a fixed pseudo-random order, the same for every run
+static std::vector<int> shuffled_keys(const size_t n)
+{
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i);
+
+    std::mt19937 rng(42);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+}
+
+// ---------------------------------------------------------------- vector
+
+static void BM_vector_push_back(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        stl::vector<int> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_vector_push_back)->ZELIX_BENCH_SIZES;
+
+static void BM_std_vector_push_back(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<int> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_std_vector_push_back)->ZELIX_BENCH_SIZES;
+
+static void BM_vector_iterate(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    stl::vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (const int x : v) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_vector_iterate)->ZELIX_BENCH_SIZES;
+
+static void BM_std_vector_iterate(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (const int x : v) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_std_vector_iterate)->ZELIX_BENCH_SIZES;
+
+// ---------------------------------------------------------------- map / set
+
+static void BM_map_insert(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        stl::map<int, int> m;
+        for (const int k : keys) m.insert(k, k);
+        benchmark::DoNotOptimize(m.size());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_map_insert)->ZELIX_BENCH_SIZES;
+
+static void BM_std_map_insert(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::map<int, int> m;
+        for (const int k : keys) m.emplace(k, k);
+        benchmark::DoNotOptimize(m.size());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_std_map_insert)->ZELIX_BENCH_SIZES;
+
+static void BM_map_lookup(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    stl::map<int, int> m;
+    for (const int k : keys) m.insert(k, k);
+
+    for (auto _ : state)
+    {
+        for (const int k : keys) benchmark::DoNotOptimize(m.try_get(k));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_map_lookup)->ZELIX_BENCH_SIZES;
+
+static void BM_std_map_lookup(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    std::map<int, int> m;
+    for (const int k : keys) m.emplace(k, k);
+
+    for (auto _ : state)
+    {
+        for (const int k : keys) benchmark::DoNotOptimize(m.find(k));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_std_map_lookup)->ZELIX_BENCH_SIZES;
+
+static void BM_map_iterate(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    stl::map<int, int> m;
+    for (const int k : keys) m.insert(k, k);
+
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (auto it = m.begin(); it != m.end(); ++it) sum += it->value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_map_iterate)->ZELIX_BENCH_SIZES;
+
+static void BM_std_map_iterate(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    std::map<int, int> m;
+    for (const int k : keys) m.emplace(k, k);
+
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (const auto &[k, v] : m) sum += v;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+}
+BENCHMARK(BM_std_map_iterate)->ZELIX_BENCH_SIZES;
+
+static void BM_set_insert_lookup(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        stl::set<int> s;
+        for (const int k : keys) s.insert(k);
+        for (const int k : keys) benchmark::DoNotOptimize(s.find(k));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size() * 2));
+}
+BENCHMARK(BM_set_insert_lookup)->ZELIX_BENCH_SIZES;
+
+static void BM_std_set_insert_lookup(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::set<int> s;
+        for (const int k : keys) s.insert(k);
+        for (const int k : keys) benchmark::DoNotOptimize(s.find(k));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size() * 2));
+}
+BENCHMARK(BM_std_set_insert_lookup)->ZELIX_BENCH_SIZES;
+
+// ---------------------------------------------------------------- hash_map
+
+static void BM_hash_map_insert_lookup(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        stl::hash_map<int, int> m;
+        for (const int k : keys) m.insert(k, k);
+        for (const int k : keys) benchmark::DoNotOptimize(m.try_get(k));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size() * 2));
+}
+BENCHMARK(BM_hash_map_insert_lookup)->ZELIX_BENCH_SIZES;
+
+static void BM_std_unordered_map_insert_lookup(benchmark::State &state)
+{
+    const auto keys = shuffled_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::unordered_map<int, int> m;
+        for (const int k : keys) m.emplace(k, k);
+        for (const int k : keys) benchmark::DoNotOptimize(m.find(k));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size() * 2));
+}
+BENCHMARK(BM_std_unordered_map_insert_lookup)->ZELIX_BENCH_SIZES;
+
+// ---------------------------------------------------------------- list
+
+static void BM_list_push_iterate(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        stl::list<int> l;
+        for (size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+
+        long sum = 0;
+        for (auto *node = l.begin(); node; node = node->next) sum += node->data;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_list_push_iterate)->ZELIX_BENCH_SIZES;
+
+static void BM_std_list_push_iterate(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::list<int> l;
+        for (size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+
+        long sum = 0;
+        for (const int x : l) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_std_list_push_iterate)->ZELIX_BENCH_SIZES;
+
+// ---------------------------------------------------------------- ring_buffer
+
+static void BM_ring_buffer_push(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    stl::ring_buffer<int, 1024, true> ring;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i) ring.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(ring.ptr());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_ring_buffer_push)->ZELIX_BENCH_SIZES;
+
+static void BM_std_deque_ring_push(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    std::deque<int> ring;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            // Same overwrite-the-oldest behaviour as a 1024 element ring_buffer
+            if (ring.size() == 1024) ring.pop_front();
+            ring.push_back(static_cast<int>(i));
+        }
+
+        benchmark::DoNotOptimize(ring.back());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_std_deque_ring_push)->ZELIX_BENCH_SIZES;
@@ -0,0 +1,127 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "zelix/algorithm/parallel.h"
+#include "zelix/algorithm/simd.h"
+#include "zelix/vector.h"
+
+using namespace zelix;
+
+static stl::vector<int> random_ints(const size_t n)
+{
+    std::mt19937 rng(7);
+    stl::vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(rng()));
+    return v;
+}
+
+/// Parallel sort, range(0) elements on a pool of range(1) threads
+static void BM_parallel_sort(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    stl::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const auto input = random_ints(n);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        stl::vector<int> v;
+        v = input;
+        state.ResumeTiming();
+
+        stl::algorithm::sort(v, std::less<>(), pool);
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_parallel_sort)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 2, 4, 8}})->UseRealTime();
+
+static void BM_std_sort(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto input = random_ints(n);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<int> v(input.data(), input.data() + n);
+        state.ResumeTiming();
+
+        std::sort(v.begin(), v.end());
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_std_sort)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_parallel_reduce(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    stl::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const auto input = random_ints(n);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stl::algorithm::reduce(input, 0L, std::plus<>(), pool));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_parallel_reduce)->ArgsProduct({{1 << 16, 1 << 20}, {1, 2, 4, 8}})->UseRealTime();
+
+static void BM_simd_count(benchmark::State &state)
+{
+    const auto input = random_ints(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stl::algorithm::count(input, input.unchecked_at(0)));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK(BM_simd_count)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void BM_std_count(benchmark::State &state)
+{
+    const auto input = random_ints(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::count(input.data(), input.data() + input.size(), input.unchecked_at(0)));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK(BM_std_count)->RangeMultiplier(16)->Range(16, 1 << 20);
@@ -0,0 +1,183 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+#include "zelix/format.h"
+#include "zelix/io.h"
+#include "zelix/owned_string.h"
+#include "zelix/string_utils.h"
+
+using namespace zelix;
+
+// ---------------------------------------------------------------- string
+
+static void BM_string_append(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        stl::string s;
+        for (size_t i = 0; i < n; ++i) s.push("token ", 6);
+        benchmark::DoNotOptimize(s.ptr());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * n * 6));
+}
+BENCHMARK(BM_string_append)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+static void BM_std_string_append(benchmark::State &state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::string s;
+        for (size_t i = 0; i < n; ++i) s.append("token ", 6);
+        benchmark::DoNotOptimize(s.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * n * 6));
+}
+BENCHMARK(BM_std_string_append)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+// ---------------------------------------------------------------- str::len
+
+/// A null-terminated run of n non-null bytes
+static std::string filled(const size_t n)
+{
+    return std::string(n, 'x');
+}
+
+static void BM_str_len(benchmark::State &state)
+{
+    const auto text = filled(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stl::str::len(text.c_str()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_str_len)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+static void BM_strlen(benchmark::State &state)
+{
+    const auto text = filled(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(strlen(text.c_str()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_strlen)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+// ---------------------------------------------------------------- formatting
+
+static void BM_format_to(benchmark::State &state)
+{
+    char buffer[256];
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stl::format_to<"line {} col {}: {}\n">(buffer, i, i * 7, 3.25));
+        ++i;
+    }
+}
+BENCHMARK(BM_format_to);
+
+static void BM_snprintf(benchmark::State &state)
+{
+    char buffer[256];
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(snprintf(buffer, sizeof(buffer), "line %zu col %zu: %g\n", i, i * 7, 3.25));
+        ++i;
+    }
+}
+BENCHMARK(BM_snprintf);
+
+static void BM_to_chars(benchmark::State &state)
+{
+    char buffer[256];
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::to_chars(buffer, buffer + sizeof(buffer), i * 7).ptr);
+        ++i;
+    }
+}
+BENCHMARK(BM_to_chars);
+
+// ---------------------------------------------------------------- ostream
+
+static void BM_fd_ostream(benchmark::State &state)
+{
+    stl::fd_ostream<4096> out(open("/dev/null", O_WRONLY));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        out << "value " << i << ' ' << 0.5 << '\n';
+        ++i;
+    }
+}
+BENCHMARK(BM_fd_ostream);
+
+static void BM_fd_ostream_format(benchmark::State &state)
+{
+    stl::fd_ostream<4096> out(open("/dev/null", O_WRONLY));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        stl::format<"value {} {}\n">(out, i, 0.5);
+        ++i;
+    }
+}
+BENCHMARK(BM_fd_ostream_format);
+
+static void BM_stdio_fprintf(benchmark::State &state)
+{
+    FILE *out = fopen("/dev/null", "w");
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        fprintf(out, "value %zu %g\n", i, 0.5);
+        ++i;
+    }
+
+    fclose(out);
+}
+BENCHMARK(BM_stdio_fprintf);
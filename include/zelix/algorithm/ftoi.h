@@ -28,69 +28,477 @@
 //
 
 #pragma once
+#include <bit>
+#include <cmath>
+#include <cstdint>
 #include <cstring>
 
+#include "zelix/algorithm/ftoi_table.h"
+#include "zelix/algorithm/itoa.h"
+#include "zelix/owned_string.h"
 #include "zelix/string_utils.h"
 
 namespace zelix::stl::algorithm {
-    inline size_t dtoi(char* buffer, double value, int decimals)
+    /// Longest output of dtoa/ftoa, e.g. "-2.2250738585072014e-308"
+    inline constexpr size_t max_shortest_chars = 25;
+
+    /// Largest precision dtoi honours; enough to spell out every subnormal
+    inline constexpr int max_fixed_decimals = 350;
+
+    /// Buffer size that fits any dtoi output, including the null terminator
+    inline constexpr size_t max_fixed_chars = 1 + 309 + 1 + max_fixed_decimals + 1;
+
+    /// A finite non-zero value as digits * 10^exponent
+    struct __decimal
     {
-        if (decimals < 0) decimals = 0;
+        uint64_t digits;
+        int exponent;
+    };
+
+    static inline uint64_t __mul_high(const uint64_t a, const uint64_t b)
+    {
+#   if defined(__SIZEOF_INT128__)
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#   else
+        const uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+        const uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+        const uint64_t lo_lo = a_lo * b_lo;
+        const uint64_t hi_lo = a_hi * b_lo;
+        const uint64_t lo_hi = a_lo * b_hi;
+        const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+        return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#   endif
+    }
+
+    // floor(q * log10(2)), floor(q * log10(3/4 * 2)) and floor(e * log2(10)),
+    // exact over the exponent ranges of double
+    static constexpr int __flog10_pow2(const int q)
+    {
+        return static_cast<int>((static_cast<int64_t>(q) * 661971961083LL) >> 41);
+    }
+
+    static constexpr int __flog10_three_quarters_pow2(const int q)
+    {
+        return static_cast<int>((static_cast<int64_t>(q) * 661971961083LL - 274743187321LL) >> 41);
+    }
+
+    static constexpr int __flog2_pow10(const int e)
+    {
+        return static_cast<int>((static_cast<int64_t>(e) * 913124641741LL) >> 38);
+    }
+
+    // Rounds g * cp / 2^127 to odd, g split into 63-bit halves
+    static inline uint64_t __round_to_odd(const uint64_t g1, const uint64_t g0, const uint64_t cp)
+    {
+        constexpr uint64_t mask63 = (uint64_t(1) << 63) - 1;
+        const uint64_t x1 = __mul_high(g0, cp);
+        const uint64_t y0 = g1 * cp;
+        const uint64_t y1 = __mul_high(g1, cp);
+        const uint64_t z = (y0 >> 1) + x1;
+        const uint64_t vbp = y1 + (z >> 63);
+        return vbp | (((z & mask63) + mask63) >> 63);
+    }
+
+    // Rounds g * cp / 2^64 to odd, for the narrower float computations
+    static inline uint32_t __round_to_odd(const uint64_t g, const uint64_t cp)
+    {
+        constexpr uint64_t mask32 = (uint64_t(1) << 32) - 1;
+        const uint64_t x1 = __mul_high(g, cp);
+        const uint64_t vbp = x1 >> 31;
+        return static_cast<uint32_t>(vbp | (((x1 & mask32) + mask32) >> 32));
+    }
+
+    /**
+     * \brief Schubfach: shortest decimal in the rounding interval of c * 2^q.
+     *
+     * Picks the closest candidate among the shortest ones, breaking ties to
+     * even, which is the same result Ryu and Dragonbox produce. The digits may
+     * carry trailing zeros.
+     */
+    static inline __decimal __to_decimal(const int q, const uint64_t c)
+    {
+        constexpr uint64_t c_min = uint64_t(1) << 52;
+        constexpr int q_min = -1074;
+
+        const uint64_t out = c & 1;
+        const uint64_t cb = c << 2;
+        const uint64_t cbr = cb + 2;
+        uint64_t cbl;
+        int k;
+
+        // At a power of two the interval below is half as wide as the one above
+        if (c != c_min || q == q_min)
+        {
+            cbl = cb - 2;
+            k = __flog10_pow2(q);
+        }
+        else
+        {
+            cbl = cb - 1;
+            k = __flog10_three_quarters_pow2(q);
+        }
+
+        const int h = q + __flog2_pow10(-k) + 2;
+        const uint64_t g1 = __pow10_table[k - __pow10_k_min][0];
+        const uint64_t g0 = __pow10_table[k - __pow10_k_min][1];
+
+        const uint64_t vb = __round_to_odd(g1, g0, cb << h);
+        const uint64_t vbl = __round_to_odd(g1, g0, cbl << h);
+        const uint64_t vbr = __round_to_odd(g1, g0, cbr << h);
 
-        // Handle negative numbers
-        const bool isNegative = value < 0;
-        if (isNegative) value = -value;
-
-        // Get integer part
-        auto int_part = static_cast<long long>(value);
-
-        // Get fractional part
-        double frac_part = value - int_part;
-
-        // Handle rounding
-        double rounding = 0.5;
-        for (int i = 0; i < decimals; ++i) rounding /= 10.0;
-        frac_part += rounding;
-        if (frac_part >= 1.0) {
-            int_part += 1;
-            frac_part -= 1.0;
-        }
-
-        // Convert integer part to string
-        char int_buffer[32];
-        int i = 0;
-        if (int_part == 0) {
-            int_buffer[i++] = '0';
-        } else {
-            long long tmp = int_part;
-            while (tmp > 0) {
-                int_buffer[i++] = '0' + (tmp % 10);
-                tmp /= 10;
+        const uint64_t s = vb >> 2;
+        if (s >= 10)
+        {
+            // Try one digit less first (never more, the interval is narrower than 10 units of s)
+            const uint64_t sp10 = 10 * __mul_high(s, 115292150460684698ull << 4);
+            const uint64_t tp10 = sp10 + 10;
+            const bool upin = vbl + out <= sp10 << 2;
+            const bool wpin = (tp10 << 2) + out <= vbr;
+            if (upin != wpin)
+            {
+                return {upin ? sp10 : tp10, k};
             }
-            // Reverse the string
-            for (int j = 0; j < i/2; ++j) {
-                const char t = int_buffer[j];
-                int_buffer[j] = int_buffer[i-1-j];
-                int_buffer[i-1-j] = t;
+        }
+
+        const uint64_t t = s + 1;
+        const bool uin = vbl + out <= s << 2;
+        const bool win = (t << 2) + out <= vbr;
+        if (uin != win)
+        {
+            return {uin ? s : t, k};
+        }
+
+        // Both candidates are in the interval, take the closest
+        const auto cmp = static_cast<int64_t>(vb - ((s + t) << 1));
+        return {cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k};
+    }
+
+    /// Same as __to_decimal, for the significand and exponent of a float
+    static inline __decimal __to_decimal_float(const int q, const uint32_t c)
+    {
+        constexpr uint32_t c_min = uint32_t(1) << 23;
+        constexpr int q_min = -149;
+
+        const uint32_t out = c & 1;
+        const uint64_t cb = static_cast<uint64_t>(c) << 2;
+        const uint64_t cbr = cb + 2;
+        uint64_t cbl;
+        int k;
+
+        if (c != c_min || q == q_min)
+        {
+            cbl = cb - 2;
+            k = __flog10_pow2(q);
+        }
+        else
+        {
+            cbl = cb - 1;
+            k = __flog10_three_quarters_pow2(q);
+        }
+
+        const int h = q + __flog2_pow10(-k) + 33;
+        const uint64_t g = __pow10_table[k - __pow10_k_min][0] + 1;
+
+        const uint32_t vb = __round_to_odd(g, cb << h);
+        const uint32_t vbl = __round_to_odd(g, cbl << h);
+        const uint32_t vbr = __round_to_odd(g, cbr << h);
+
+        const uint32_t s = vb >> 2;
+        if (s >= 10)
+        {
+            const auto sp10 = static_cast<uint32_t>(10 * ((s * 1717986919ull) >> 34));
+            const uint32_t tp10 = sp10 + 10;
+            const bool upin = vbl + out <= sp10 << 2;
+            const bool wpin = (tp10 << 2) + out <= vbr;
+            if (upin != wpin)
+            {
+                return {upin ? sp10 : tp10, k};
+            }
+        }
+
+        const uint32_t t = s + 1;
+        const bool uin = vbl + out <= s << 2;
+        const bool win = (t << 2) + out <= vbr;
+        if (uin != win)
+        {
+            return {uin ? s : t, k};
+        }
+
+        const auto cmp = static_cast<int32_t>(vb - ((s + t) << 1));
+        return {cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k};
+    }
+
+    /// Decodes a finite non-zero double into its shortest round-trip decimal
+    static inline __decimal __shortest(const double value)
+    {
+        const auto bits = std::bit_cast<uint64_t>(value);
+        const auto bq = static_cast<int>((bits >> 52) & 0x7FF);
+        const uint64_t t = bits & ((uint64_t(1) << 52) - 1);
+
+        if (bq != 0)
+        {
+            const uint64_t c = (uint64_t(1) << 52) | t;
+            const int q = bq - 1075;
+
+            // Integers below 2^53 are their own shortest representation
+            if (0 < -q && -q < 53)
+            {
+                if (const uint64_t f = c >> -q; f << -q == c)
+                {
+                    return {f, 0};
+                }
             }
+
+            return __to_decimal(q, c);
+        }
+
+        return __to_decimal(-1074, t); // Subnormal
+    }
+
+    /// Decodes a finite non-zero float into its shortest round-trip decimal
+    static inline __decimal __shortest(const float value)
+    {
+        const auto bits = std::bit_cast<uint32_t>(value);
+        const auto bq = static_cast<int>((bits >> 23) & 0xFF);
+        const uint32_t t = bits & ((uint32_t(1) << 23) - 1);
+
+        if (bq != 0)
+        {
+            return __to_decimal_float(bq - 150, (uint32_t(1) << 23) | t);
+        }
+
+        return __to_decimal_float(-149, t); // Subnormal
+    }
+
+    // Writes nan/inf/zero, returns 0 if the value is an ordinary number
+    template <typename T>
+    static inline size_t __write_special(char *buffer, const T value)
+    {
+        if (value != value)
+        {
+            memcpy(buffer, "nan", 3);
+            return 3;
+        }
+
+        size_t pos = 0;
+        if (std::signbit(value)) buffer[pos++] = '-';
+
+        if (value == T(0))
+        {
+            buffer[pos] = '0';
+            return pos + 1;
+        }
+
+        if (value - value != value - value) // Infinity
+        {
+            memcpy(buffer + pos, "inf", 3);
+            return pos + 3;
+        }
+
+        return 0;
+    }
+
+    /**
+     * \brief Lays out a shortest decimal the way JavaScript prints numbers.
+     *
+     * Plain notation while the decimal point sits within 21 digits of the
+     * integer part and no more than 6 zeros after it, scientific otherwise.
+     */
+    static inline size_t __write_shortest(char *buffer, size_t pos, __decimal d)
+    {
+        while (d.digits % 10 == 0)
+        {
+            d.digits /= 10;
+            d.exponent++;
+        }
+
+        const auto n = static_cast<int>(__digit_count(d.digits));
+        const int point = n + d.exponent; // Position of the decimal point from the first digit
+
+        if (n <= point && point <= 21)
+        {
+            // Integer, pad with zeros
+            __write_digits(buffer + pos + n, d.digits, n);
+            pos += n;
+            memset(buffer + pos, '0', point - n);
+            return pos + (point - n);
         }
-        int_buffer[i] = '\0';
 
-        // Start filling the main buffer
-        int pos = 0;
-        if (isNegative) buffer[pos++] = '-';
-        strcpy(buffer + pos, int_buffer);
-        pos += str::len(int_buffer);
+        if (0 < point && point <= 21)
+        {
+            // Point inside the digits
+            __write_digits(buffer + pos + n + 1, d.digits, n);
+            memmove(buffer + pos, buffer + pos + 1, point);
+            buffer[pos + point] = '.';
+            return pos + n + 1;
+        }
 
-        // Add decimal point and fractional digits
-        if (decimals > 0) {
+        if (-6 < point && point <= 0)
+        {
+            // 0.000ddd
+            buffer[pos++] = '0';
             buffer[pos++] = '.';
-            for (int d = 0; d < decimals; ++d) {
-                frac_part *= 10;
-                const int digit = static_cast<int>(frac_part);
-                buffer[pos++] = '0' + digit;
-                frac_part -= digit;
+            memset(buffer + pos, '0', -point);
+            pos += -point;
+            __write_digits(buffer + pos + n, d.digits, n);
+            return pos + n;
+        }
+
+        // d[.ddd]e±x
+        __write_digits(buffer + pos + n + 1, d.digits, n);
+        buffer[pos] = buffer[pos + 1];
+        if (n > 1)
+        {
+            buffer[pos + 1] = '.';
+            pos += n + 1;
+        }
+        else
+        {
+            pos += 1;
+        }
+
+        int e = point - 1;
+        buffer[pos++] = 'e';
+        buffer[pos++] = e < 0 ? '-' : '+';
+        if (e < 0) e = -e;
+
+        const size_t e_len = __digit_count(static_cast<uint64_t>(e));
+        __write_digits(buffer + pos + e_len, static_cast<uint64_t>(e), e_len);
+        return pos + e_len;
+    }
+
+    /**
+     * \brief Writes the shortest decimal that parses back to exactly value.
+     *
+     * Uses the Schubfach algorithm: no big integers, no loops over digits to
+     * find the representation, and no locale. Writes at most max_shortest_chars
+     * characters straight into buffer and does not null-terminate.
+     *
+     * \return The number of characters written.
+     */
+    static inline size_t dtoa(char *buffer, const double value)
+    {
+        if (const size_t special = __write_special(buffer, value))
+        {
+            return special;
+        }
+
+        size_t pos = 0;
+        if (value < 0) buffer[pos++] = '-';
+        return __write_shortest(buffer, pos, __shortest(value));
+    }
+
+    /// Float counterpart of dtoa, shortest for float precision (0.1f prints as 0.1)
+    static inline size_t ftoa(char *buffer, const float value)
+    {
+        if (const size_t special = __write_special(buffer, value))
+        {
+            return special;
+        }
+
+        size_t pos = 0;
+        if (value < 0) buffer[pos++] = '-';
+        return __write_shortest(buffer, pos, __shortest(value));
+    }
+
+    static inline string dtoa(const double value)
+    {
+        string r;
+        r.reserve(max_shortest_chars);
+        r.calibrate(dtoa(r.ptr(), value));
+        return r;
+    }
+
+    static inline string ftoa(const float value)
+    {
+        string r;
+        r.reserve(max_shortest_chars);
+        r.calibrate(ftoa(r.ptr(), value));
+        return r;
+    }
+
+    /// A double to be written with a fixed number of decimals, see dtoi
+    struct fixed
+    {
+        double value;
+        int decimals;
+    };
+
+    /**
+     * \brief Formats value with a fixed number of decimals.
+     *
+     * The shortest round-trip digits are rounded half-to-even, so the output
+     * agrees with what dtoa prints (2.675 becomes 2.68) rather than with the
+     * binary expansion. The buffer must hold max_fixed_chars bytes in the worst
+     * case; the result is null-terminated.
+     *
+     * \return The number of characters written, excluding the terminator.
+     */
+    inline size_t dtoi(char* buffer, const double value, int decimals)
+    {
+        if (decimals < 0) decimals = 0;
+        if (decimals > max_fixed_decimals) decimals = max_fixed_decimals;
+
+        if (value != value || value - value != value - value) // nan or infinity
+        {
+            const size_t len = __write_special(buffer, value);
+            buffer[len] = '\0';
+            return len;
+        }
+
+        size_t pos = 0;
+        if (std::signbit(value)) buffer[pos++] = '-';
+
+        // The value in units of 10^-decimals is q * 10^zeros
+        uint64_t q = 0;
+        int zeros = 0;
+        if (value != 0)
+        {
+            const auto [digits, exponent] = __shortest(value);
+            if (exponent >= -decimals)
+            {
+                q = digits;
+                zeros = exponent + decimals;
             }
+            else if (const int drop = -decimals - exponent; drop <= static_cast<int>(__digit_count(digits)))
+            {
+                uint64_t p = 1;
+                for (int i = 0; i < drop; ++i) p *= 10;
+
+                q = digits / p;
+                const uint64_t r = digits % p;
+                if (const uint64_t half = p / 2; r > half || (r == half && (q & 1)))
+                {
+                    q++;
+                }
+            }
+            // Otherwise the value is below half a unit and rounds to zero
+        }
+
+        const size_t q_len = q == 0 ? 1 : __digit_count(q);
+        const size_t length = q == 0 ? 1 : q_len + zeros; // Digits of the scaled value
+        const size_t lead = length <= static_cast<size_t>(decimals) ? decimals + 1 - length : 0;
+
+        memset(buffer + pos, '0', lead);
+        pos += lead;
+        if (q != 0)
+        {
+            __write_digits(buffer + pos + q_len, q, q_len);
+            pos += q_len;
+            memset(buffer + pos, '0', zeros);
+            pos += zeros;
+        }
+        else
+        {
+            buffer[pos++] = '0';
+        }
+
+        if (decimals > 0)
+        {
+            // Open a gap for the point before the last `decimals` digits
+            memmove(buffer + pos - decimals + 1, buffer + pos - decimals, decimals);
+            buffer[pos - decimals] = '.';
+            pos++;
         }
 
         buffer[pos] = '\0';
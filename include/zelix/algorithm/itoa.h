@@ -28,82 +28,183 @@
 //
 
 #pragma once
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
 #include "zelix/owned_string.h"
 
 namespace zelix::stl::algorithm
 {
-    static inline size_t itoa(long value, char *ptr)
+    inline constexpr uint64_t __pow10_u64[20] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+        100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+        10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+        100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+    };
+
+    inline constexpr char __digit_pairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    /// Number of decimal digits in v, zero counts as one digit
+    static inline size_t __digit_count(const uint64_t v)
+    {
+        // log10(2) ~ 1233 / 4096, then fix up the estimate with one comparison
+        const auto estimate = static_cast<size_t>((std::bit_width(v | 1) * 1233) >> 12);
+        return estimate + ((v | 1) >= __pow10_u64[estimate]);
+    }
+
+    // Writes the n lowest digits of v ending right before end, two at a time
+    static inline void __write_digits(char *end, uint64_t v, size_t n)
     {
-        // Edge case: when the value is 0
-        if (value == 0)
+        for (; n >= 2; n -= 2)
         {
-            ptr[0] = '0';
-            return 1;
+            const auto pair = static_cast<size_t>(v % 100) * 2;
+            v /= 100;
+            end -= 2;
+            memcpy(end, __digit_pairs + pair, 2);
         }
 
-        long chars = 0;
-        int is_negative = false;
-
-        // Negate the number if needed
-        if (value < 0)
+        if (n)
         {
-            value = -value;
-            is_negative = true;
+            *--end = static_cast<char>('0' + v % 10);
         }
+    }
 
-        // Calculate the number of characters we are going to need
-        long value_clone = value;
-        while (value_clone > 0)
+    /// Longest itoa output for 64-bit integers, "-9223372036854775808" or "18446744073709551615"
+    inline constexpr size_t max_integer_chars = 20;
+
+    /**
+     * \brief Writes an unsigned value in decimal.
+     *
+     * The length is known up front, so digits are written straight to their
+     * final position, two per division. Writes at most max_integer_chars
+     * characters and does not null-terminate.
+     *
+     * \return The number of characters written.
+     */
+    static inline size_t utoa(const uint64_t value, char *ptr)
+    {
+        const size_t n = __digit_count(value);
+        __write_digits(ptr + n, value, n);
+        return n;
+    }
+
+    /**
+     * \brief Writes any integral value in decimal.
+     *
+     * Signed values are negated in unsigned arithmetic, so the minimum value
+     * of every type is printed correctly.
+     *
+     * \return The number of characters written.
+     */
+    template <
+        typename T,
+        typename = std::enable_if_t<std::is_integral_v<T>>
+    >
+    static inline size_t itoa(const T value, char *ptr)
+    {
+        if constexpr (std::is_signed_v<T>)
         {
-            // Increment the count
-            chars++;
-            // Decrement the number
-            value_clone = value_clone / 10;
-        }
+            const bool negative = value < 0;
+            const auto magnitude = static_cast<uint64_t>(static_cast<int64_t>(value));
 
-        // Add 1 if the number is negative
-        if (is_negative)
+            *ptr = '-'; // Overwritten by the first digit if not negative
+            return negative + utoa(negative ? 0 - magnitude : magnitude, ptr + negative);
+        }
+        else
         {
-            chars++;
+            return utoa(static_cast<uint64_t>(value), ptr);
         }
+    }
 
-        // Position the index accordingly
-        long index = chars - 1;
+#   ifdef __SIZEOF_INT128__
+    /// Longest itoa output for 128-bit integers (39 digits and a sign)
+    inline constexpr size_t max_int128_chars = 40;
 
-        // Put character by character in the buffer
-        while (value > 0)
+    static inline size_t utoa(unsigned __int128 value, char *ptr)
+    {
+        if (value <= UINT64_MAX)
         {
-            // Get the digit
-            const long digit = value % 10;
+            return utoa(static_cast<uint64_t>(value), ptr);
+        }
 
-            // Put the character
-            ptr[index] = (char)('0' + digit);
-            index--;
+        // Peel off zero-padded groups of 19 digits, the head has at most 20
+        constexpr uint64_t group = 10000000000000000000ull;
+        const auto low = static_cast<uint64_t>(value % group);
+        value /= group;
 
-            // Decrement the number
-            value = value / 10;
+        size_t n;
+        if (value <= UINT64_MAX)
+        {
+            n = utoa(static_cast<uint64_t>(value), ptr);
         }
-
-        // Add a negative sign
-        if (is_negative)
+        else
         {
-            ptr[0] = '-';
+            const auto mid = static_cast<uint64_t>(value % group);
+            n = utoa(static_cast<uint64_t>(value / group), ptr);
+            __write_digits(ptr + n + 19, mid, 19);
+            n += 19;
         }
 
-        return chars;
+        __write_digits(ptr + n + 19, low, 19);
+        return n + 19;
+    }
+
+    static inline size_t itoa(const unsigned __int128 value, char *ptr)
+    {
+        return utoa(value, ptr);
+    }
+
+    static inline size_t itoa(const __int128 value, char *ptr)
+    {
+        const bool negative = value < 0;
+        const auto magnitude = static_cast<unsigned __int128>(value);
+
+        *ptr = '-';
+        return negative + utoa(negative ? 0 - magnitude : magnitude, ptr + negative);
     }
+#   endif
 
-    static inline string itoa(const long value)
+    /**
+     * \brief Writes value in hexadecimal, without a prefix or leading zeros.
+     *
+     * \return The number of characters written, at most 16.
+     */
+    static inline size_t itoa_hex(uint64_t value, char *ptr, const bool uppercase = false)
     {
-        if (value == 0)
+        const char *digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+        const size_t n = (std::bit_width(value | 1) + 3) / 4;
+
+        for (size_t i = n; i-- > 0;)
         {
-            // Return 0 directly
-            return "0";
+            ptr[i] = digits[value & 0xF];
+            value >>= 4;
         }
 
+        return n;
+    }
+
+    /// Longest itoa output for an integer of type T
+    template <typename T>
+    inline constexpr size_t __max_itoa_chars =
+#   ifdef __SIZEOF_INT128__
+        sizeof(T) > sizeof(uint64_t) ? max_int128_chars :
+#   endif
+        max_integer_chars;
+
+    template <
+        typename T,
+        typename = std::enable_if_t<std::is_integral_v<T>>
+    >
+    static inline string itoa(const T value)
+    {
         string r;
-        r.reserve(22); // Reserve enough space for a long integer
-        r.calibrate(itoa(value, r.ptr())); // Convert the long to string and calibrate the length
+        r.reserve(__max_itoa_chars<T>); // Fits inline up to 64 bits
+        r.calibrate(itoa(value, r.ptr())); // Convert the value to string and calibrate the length
         return r; // Return the resulting string
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,335 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "zelix/except/out_of_range.h"
+#include "zelix/memory/system_resource.h"
+#include "zelix/optional.h"
+#include "zelix/algorithm/simd.h"
+#include "zelix/thread_pool.h"
+#include "zelix/vector.h"
+
+namespace zelix::stl::algorithm
+{
+    /// Smallest number of elements worth handing to another thread
+    inline constexpr size_t parallel_grain = 4096;
+
+    /// Number of chunks to cut n elements into: a few per thread, none smaller than grain
+    static inline size_t __chunk_count(const thread_pool &pool, const size_t n, const size_t grain)
+    {
+        const size_t by_size = (n + grain - 1) / grain;
+        const size_t by_threads = (pool.size() + 1) * 4;
+        const size_t chunks = by_size < by_threads ? by_size : by_threads;
+        return chunks == 0 ? 1 : chunks;
+    }
+
+    /**
+     * @brief Runs fn(chunk, begin, end) over `chunks` equal slices of [0, n), the last one on the calling thread.
+     */
+    template <typename F>
+    void __parallel_chunks(thread_pool &pool, const size_t n, const size_t chunks, F &&fn)
+    {
+        if (chunks <= 1)
+        {
+            fn(size_t(0), size_t(0), n);
+            return;
+        }
+
+        task_group group(pool);
+        for (size_t c = 0; c + 1 < chunks; ++c)
+        {
+            group.run([&fn, c, n, chunks] { fn(c, n * c / chunks, n * (c + 1) / chunks); });
+        }
+
+        fn(chunks - 1, n * (chunks - 1) / chunks, n);
+        group.wait();
+    }
+
+    /**
+     * @brief Calls fn on every element, in parallel.
+     *
+     * @param range Any contiguous range with data() and size(), such as vector or span.
+     * @param fn Callable taking an element reference; runs concurrently on distinct elements.
+     */
+    template <typename Range, typename F>
+    void for_each(Range &range, F fn, thread_pool &pool = thread_pool::global(), const size_t grain = parallel_grain)
+    {
+        auto *data = range.data();
+        const size_t n = range.size();
+        __parallel_chunks(pool, n, __chunk_count(pool, n, grain), [data, &fn](size_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) fn(data[i]);
+        });
+    }
+
+    /**
+     * @brief Writes fn(in[i]) to out[i] for every element, in parallel.
+     *
+     * @throws except::out_of_range If out is smaller than in.
+     */
+    template <typename In, typename Out, typename F>
+    void transform(const In &in, Out &out, F fn, thread_pool &pool = thread_pool::global(), const size_t grain = parallel_grain)
+    {
+        const size_t n = in.size();
+        if (out.size() < n) throw except::out_of_range("transform output is smaller than the input");
+
+        const auto *src = in.data();
+        auto *dst = out.data();
+        __parallel_chunks(pool, n, __chunk_count(pool, n, grain), [src, dst, &fn](size_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) dst[i] = fn(src[i]);
+        });
+    }
+
+    /**
+     * @brief Folds every element into init with op, in parallel.
+     *
+     * Each chunk is folded separately and the partial results are combined
+     * in order, so op must be associative but need not be commutative.
+     */
+    template <typename Range, typename T, typename Op = std::plus<>>
+    T reduce(const Range &range, T init, Op op = Op(), thread_pool &pool = thread_pool::global(), const size_t grain = parallel_grain)
+    {
+        const auto *data = range.data();
+        const size_t n = range.size();
+        if (n == 0) return init;
+
+        const size_t chunks = __chunk_count(pool, n, grain);
+        vector<optional<T>> partial;
+        partial.resize(chunks);
+
+        __parallel_chunks(pool, n, chunks, [data, &op, &partial](const size_t c, const size_t begin, const size_t end) {
+            T acc = data[begin];
+            for (size_t i = begin + 1; i < end; ++i) acc = op(stl::move(acc), data[i]);
+            partial.unchecked_at(c) = optional<T>::some(stl::move(acc));
+        });
+
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            init = op(stl::move(init), stl::move(partial.unchecked_at(c).get()));
+        }
+
+        return init;
+    }
+
+    /// Merges sorted [a, a + an) and [b, b + bn) into dst, split into `pieces` independent merges
+    template <typename T, typename Cmp>
+    void __parallel_merge(task_group &group, T *a, const size_t an, T *b, const size_t bn, T *dst, const size_t pieces, Cmp &cmp)
+    {
+        // Find every split before launching, the merges move out of b
+        vector<size_t> b_split;
+        b_split.push_back(0);
+        for (size_t p = 1; p < pieces && an > 0; ++p)
+        {
+            b_split.push_back(static_cast<size_t>(std::lower_bound(b, b + bn, a[an * p / pieces], cmp) - b));
+        }
+        while (b_split.size() < pieces) b_split.push_back(0);
+        b_split.push_back(bn);
+
+        for (size_t p = 0; p < pieces; ++p)
+        {
+            const size_t a_lo = an * p / pieces, a_hi = an * (p + 1) / pieces;
+            const size_t b_lo = b_split.unchecked_at(p), b_hi = b_split.unchecked_at(p + 1);
+
+            group.run([=, &cmp] {
+                std::merge(
+                    std::make_move_iterator(a + a_lo), std::make_move_iterator(a + a_hi),
+                    std::make_move_iterator(b + b_lo), std::make_move_iterator(b + b_hi),
+                    dst + a_lo + b_lo, cmp
+                );
+            });
+        }
+    }
+
+    /// Sorts one chunk, numbers under the default ordering go through the vectorized kernels
+    template <typename T, typename Cmp>
+    void __sort_chunk(T *data, const size_t n, Cmp &cmp)
+    {
+        if constexpr (__radix_sortable_v<T> && (std::is_same_v<Cmp, std::less<>> || std::is_same_v<Cmp, std::less<T>>))
+        {
+            __sort_numbers(data, n);
+        }
+        else
+        {
+            std::sort(data, data + n, cmp);
+        }
+    }
+
+    /**
+     * @brief Sorts the range in parallel (not stable).
+     *
+     * Chunks are sorted independently, then merged pairwise in log2(chunks)
+     * rounds; each merge is itself split at binary-searched points so late
+     * rounds still use every thread. Numbers under the default ordering are
+     * chunk-sorted with radix_sort and the AVX2 kernels from simd.h.
+     */
+    template <typename Range, typename Cmp = std::less<>>
+    void sort(Range &range, Cmp cmp = Cmp(), thread_pool &pool = thread_pool::global(), const size_t grain = parallel_grain)
+    {
+        using T = __range_value_t<Range>;
+        T *data = range.data();
+        const size_t n = range.size();
+        const size_t chunks = __chunk_count(pool, n, grain);
+        if (chunks <= 1)
+        {
+            __sort_chunk(data, n, cmp);
+            return;
+        }
+
+        vector<size_t> bounds;
+        for (size_t c = 0; c <= chunks; ++c) bounds.push_back(n * c / chunks);
+
+        __parallel_chunks(pool, n, chunks, [data, &cmp, &bounds](const size_t c, size_t, size_t) {
+            const size_t begin = bounds.unchecked_at(c);
+            __sort_chunk(data + begin, bounds.unchecked_at(c + 1) - begin, cmp);
+        });
+
+        // The sorted chunks move into the buffer, the first round merges them back
+        T *buffer = memory::system_array_resource<T>::allocate(n);
+        __parallel_chunks(pool, n, chunks, [data, buffer](size_t, const size_t begin, const size_t end) {
+            std::uninitialized_move(data + begin, data + end, buffer + begin);
+        });
+
+        T *src = buffer;
+        T *dst = data;
+        while (bounds.size() > 2)
+        {
+            const size_t runs = bounds.size() - 1;
+            const size_t pairs = runs / 2;
+            const size_t pieces = chunks / pairs < 1 ? 1 : chunks / pairs;
+
+            vector<size_t> merged;
+            {
+                task_group group(pool);
+                for (size_t r = 0; r + 1 < runs; r += 2)
+                {
+                    const size_t lo = bounds.unchecked_at(r), mid = bounds.unchecked_at(r + 1), hi = bounds.unchecked_at(r + 2);
+                    __parallel_merge(group, src + lo, mid - lo, src + mid, hi - mid, dst + lo, pieces, cmp);
+                    merged.push_back(lo);
+                }
+
+                if (runs % 2)
+                {
+                    // Odd run out, carry it over unchanged
+                    const size_t lo = bounds.unchecked_at(runs - 1);
+                    std::move(src + lo, src + n, dst + lo);
+                    merged.push_back(lo);
+                }
+
+                group.wait();
+            }
+
+            merged.push_back(n);
+            bounds = stl::move(merged);
+
+            T *tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+
+        if (src != data)
+        {
+            __parallel_chunks(pool, n, chunks, [buffer, data](size_t, const size_t begin, const size_t end) {
+                std::move(buffer + begin, buffer + end, data + begin);
+            });
+        }
+
+        std::destroy(buffer, buffer + n);
+        memory::system_array_resource<T>::deallocate(buffer);
+    }
+
+    /**
+     * @brief Moves the elements satisfying pred before the others, preserving relative order, in parallel.
+     *
+     * @return The number of elements satisfying pred.
+     */
+    template <typename Range, typename Pred>
+    size_t partition(Range &range, Pred pred, thread_pool &pool = thread_pool::global(), const size_t grain = parallel_grain)
+    {
+        using T = __range_value_t<Range>;
+        T *data = range.data();
+        const size_t n = range.size();
+        if (n == 0) return 0;
+
+        const size_t chunks = __chunk_count(pool, n, grain);
+        auto *flags = memory::system_array_resource<unsigned char>::allocate(n);
+        vector<size_t> selected;
+        selected.resize(chunks);
+
+        // Evaluate pred once per element and count the hits of each chunk
+        __parallel_chunks(pool, n, chunks, [data, flags, &pred, &selected](const size_t c, const size_t begin, const size_t end) {
+            size_t hits = 0;
+            for (size_t i = begin; i < end; ++i)
+            {
+                flags[i] = pred(static_cast<const T &>(data[i])) ? 1 : 0;
+                hits += flags[i];
+            }
+
+            selected.unchecked_at(c) = hits;
+        });
+
+        vector<size_t> true_at, false_at;
+        size_t total = 0;
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            true_at.push_back(total);
+            total += selected.unchecked_at(c);
+        }
+
+        size_t rejected = total;
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            false_at.push_back(rejected);
+            rejected += n * (c + 1) / chunks - n * c / chunks - selected.unchecked_at(c);
+        }
+
+        T *buffer = memory::system_array_resource<T>::allocate(n);
+        __parallel_chunks(pool, n, chunks, [&](const size_t c, const size_t begin, const size_t end) {
+            size_t t = true_at.unchecked_at(c), f = false_at.unchecked_at(c);
+            for (size_t i = begin; i < end; ++i)
+            {
+                new (&buffer[flags[i] ? t++ : f++]) T(stl::move(data[i]));
+            }
+        });
+
+        __parallel_chunks(pool, n, chunks, [buffer, data](size_t, const size_t begin, const size_t end) {
+            std::move(buffer + begin, buffer + end, data + begin);
+            std::destroy(buffer + begin, buffer + end);
+        });
+
+        memory::system_array_resource<T>::deallocate(buffer);
+        memory::system_array_resource<unsigned char>::deallocate(flags);
+        return total;
+    }
+}
@@ -0,0 +1,392 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "zelix/algorithm/ftoi.h" // __mul_high
+#include "zelix/algorithm/parse_table.h"
+#include "zelix/external_string.h"
+#include "zelix/optional.h"
+#include "zelix/string_utils.h"
+
+namespace zelix::stl::algorithm
+{
+    /// A parsed value and how many characters of the input it took
+    template <typename T>
+    struct parsed
+    {
+        T value;
+        size_t length;
+    };
+
+    static inline uint64_t __load_eight(const char *p)
+    {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            v = __builtin_bswap64(v); // Digits are processed in little-endian order
+        }
+
+        return v;
+    }
+
+    // True when all eight bytes are '0'..'9'
+    static inline bool __is_eight_digits(const uint64_t v)
+    {
+        return ((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+            == 0x3333333333333333ull;
+    }
+
+    // Converts eight ASCII digits (first digit in the lowest byte) in three multiplies
+    static inline uint32_t __eight_digits(uint64_t v)
+    {
+        constexpr uint64_t mask = 0x000000FF000000FFull;
+        constexpr uint64_t mul1 = 100 + (1000000ull << 32);
+        constexpr uint64_t mul2 = 1 + (10000ull << 32);
+
+        v -= 0x3030303030303030ull;
+        v = v * 10 + (v >> 8); // Pairs of digits in every other byte
+        return static_cast<uint32_t>(((v & mask) * mul1 + ((v >> 16) & mask) * mul2) >> 32);
+    }
+
+    static inline bool __is_digit(const char c)
+    {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    // Accumulates a run of digits into w, wrapping on overflow, and returns its end
+    static inline const char *__parse_digits(const char *p, const char *end, uint64_t &w)
+    {
+        while (end - p >= 8)
+        {
+            const uint64_t chunk = __load_eight(p);
+            if (!__is_eight_digits(chunk)) break;
+
+            w = w * 100000000 + __eight_digits(chunk);
+            p += 8;
+        }
+
+        while (p != end && __is_digit(*p))
+        {
+            w = w * 10 + static_cast<uint64_t>(*p - '0');
+            ++p;
+        }
+
+        return p;
+    }
+
+    /**
+     * \brief Parses a decimal integer from the start of [s, s + n).
+     *
+     * Accepts an optional '-' for signed types followed by one or more digits;
+     * no whitespace, no '+' and no base prefix, like std::from_chars. Digits
+     * are consumed eight at a time with SWAR arithmetic.
+     *
+     * \return The value and the number of characters consumed, or none when
+     *         there are no digits or the value does not fit in T.
+     */
+    template <
+        typename T,
+        typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>
+    >
+    static inline optional<parsed<T>> parse_int(const char *s, const size_t n) noexcept
+    {
+        const char *p = s;
+        const char *end = s + n;
+
+        bool negative = false;
+        if constexpr (std::is_signed_v<T>)
+        {
+            negative = p != end && *p == '-';
+            p += negative;
+        }
+
+        const char *digits = p;
+        while (p != end && *p == '0') ++p; // Leading zeros never overflow
+        const char *significant = p;
+
+        uint64_t w = 0;
+        p = __parse_digits(p, end, w);
+        if (p == digits) return optional<parsed<T>>::none();
+
+        // 19 digits always fit, a 20th only below 2^64, a 21st never
+        if (const auto count = static_cast<size_t>(p - significant); count > 19)
+        {
+            if (count > 20) return optional<parsed<T>>::none();
+
+            uint64_t head = 0;
+            __parse_digits(significant, significant + 19, head);
+            const auto last = static_cast<uint64_t>(significant[19] - '0');
+            if (head > (UINT64_MAX - last) / 10) return optional<parsed<T>>::none();
+        }
+
+        using U = std::make_unsigned_t<T>;
+        const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + negative;
+        if (w > limit) return optional<parsed<T>>::none();
+
+        const auto magnitude = static_cast<U>(w);
+        const T value = negative ? static_cast<T>(U(0) - magnitude) : static_cast<T>(magnitude);
+        return optional<parsed<T>>::some({value, static_cast<size_t>(p - s)});
+    }
+
+    template <typename T>
+    static inline optional<parsed<T>> parse_int(const external_string &s) noexcept
+    {
+        return parse_int<T>(s.ptr(), s.size());
+    }
+
+    /// Result of Eisel-Lemire before it is packed into a double
+    struct __binary_float
+    {
+        uint64_t mantissa;
+        int power2; ///< Biased exponent, 0x7FF for infinity
+    };
+
+    /**
+     * \brief Eisel-Lemire: rounds w * 10^q to the nearest double.
+     *
+     * Exact for any w below 10^19 (Mushtak and Lemire showed the 128-bit
+     * product never needs a fallback in that case).
+     */
+    static inline __binary_float __eisel_lemire(const int64_t q, uint64_t w)
+    {
+        constexpr int mantissa_bits = 52;
+
+        if (w == 0 || q < __pow5_q_min) return {0, 0};
+        if (q > __pow5_q_max) return {0, 0x7FF};
+
+        const int lz = std::countl_zero(w);
+        w <<= lz;
+
+        // 128-bit truncated product of w and 5^q, refined with the low half when needed
+        const auto index = static_cast<size_t>(q - __pow5_q_min);
+        uint64_t high = __mul_high(w, __pow5_table[index][0]);
+        uint64_t low = w * __pow5_table[index][0];
+
+        constexpr uint64_t precision_mask = UINT64_MAX >> (mantissa_bits + 3);
+        if ((high & precision_mask) == precision_mask)
+        {
+            const uint64_t second = __mul_high(w, __pow5_table[index][1]);
+            low += second;
+            high += second > low;
+        }
+
+        const auto upper_bit = static_cast<int>(high >> 63);
+        const int shift = upper_bit + 64 - mantissa_bits - 3;
+        uint64_t mantissa = high >> shift;
+
+        // floor(q * log2(10)) + 63, plus the bias of 1023
+        int power2 = static_cast<int>(((152170 + 65536) * q) >> 16) + 63 + upper_bit - lz + 1023;
+
+        if (power2 <= 0)
+        {
+            // Subnormal: shift into place and round, possibly up into the normals
+            if (-power2 + 1 >= 64) return {0, 0};
+
+            mantissa >>= -power2 + 1;
+            mantissa += mantissa & 1;
+            mantissa >>= 1;
+            return {mantissa, mantissa < (uint64_t(1) << mantissa_bits) ? 0 : 1};
+        }
+
+        // Exactly halfway is only possible for small exponents, round to even there
+        if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == high)
+        {
+            mantissa &= ~uint64_t(1);
+        }
+
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        if (mantissa >= (uint64_t(2) << mantissa_bits))
+        {
+            mantissa = uint64_t(1) << mantissa_bits;
+            power2++;
+        }
+
+        mantissa &= ~(uint64_t(1) << mantissa_bits);
+        if (power2 >= 0x7FF) return {0, 0x7FF};
+
+        return {mantissa, power2};
+    }
+
+    static inline bool __matches_word(const char *p, const char *end, const char *word, const size_t len)
+    {
+        if (static_cast<size_t>(end - p) < len) return false;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            if (str::to_lower_ascii(p[i]) != word[i]) return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Parses a decimal floating-point number from the start of [s, s + n).
+     *
+     * Accepts [-]digits[.digits][(e|E)[+|-]digits] as well as inf, infinity and
+     * nan in any case. The result is correctly rounded and does not depend on
+     * the locale. Short inputs take Clinger's exact fast path, everything else
+     * Eisel-Lemire; only mantissas over 19 digits that fall on a rounding
+     * boundary are handed to std::from_chars.
+     *
+     * \return The value and the number of characters consumed, or none when the
+     *         input does not start with a number.
+     */
+    static inline optional<parsed<double>> parse_double(const char *s, const size_t n) noexcept
+    {
+        const char *p = s;
+        const char *end = s + n;
+
+        const bool negative = p != end && *p == '-';
+        p += negative;
+
+        const auto done = [&](double value, const char *stop)
+        {
+            return optional<parsed<double>>::some({negative ? -value : value, static_cast<size_t>(stop - s)});
+        };
+
+        if (p != end && !__is_digit(*p) && *p != '.')
+        {
+            if (__matches_word(p, end, "infinity", 8)) return done(std::numeric_limits<double>::infinity(), p + 8);
+            if (__matches_word(p, end, "inf", 3)) return done(std::numeric_limits<double>::infinity(), p + 3);
+            if (__matches_word(p, end, "nan", 3)) return done(std::numeric_limits<double>::quiet_NaN(), p + 3);
+            return optional<parsed<double>>::none();
+        }
+
+        uint64_t w = 0;
+        const char *int_begin = p;
+        p = __parse_digits(p, end, w);
+        const char *int_end = p;
+
+        const char *frac_begin = p;
+        const char *frac_end = p;
+        if (p != end && *p == '.')
+        {
+            frac_begin = ++p;
+            p = __parse_digits(p, end, w);
+            frac_end = p;
+        }
+
+        auto digit_count = static_cast<size_t>((int_end - int_begin) + (frac_end - frac_begin));
+        if (digit_count == 0) return optional<parsed<double>>::none();
+
+        int64_t exponent = -(frac_end - frac_begin);
+        if (p != end && (*p | 0x20) == 'e')
+        {
+            const char *e = p + 1;
+            const bool exp_negative = e != end && *e == '-';
+            e += e != end && (*e == '-' || *e == '+');
+
+            if (e != end && __is_digit(*e))
+            {
+                int64_t explicit_exp = 0;
+                for (; e != end && __is_digit(*e); ++e)
+                {
+                    // Saturate, anything this large is zero or infinity anyway
+                    if (explicit_exp < 0x10000000) explicit_exp = explicit_exp * 10 + (*e - '0');
+                }
+
+                exponent += exp_negative ? -explicit_exp : explicit_exp;
+                p = e;
+            }
+            // Otherwise the 'e' is not part of the number
+        }
+
+        bool truncated = false;
+        if (digit_count > 19)
+        {
+            // Leading zeros are not significant
+            const char *first = int_begin;
+            while (first != frac_end && (*first == '0' || *first == '.'))
+            {
+                digit_count -= *first == '0';
+                ++first;
+            }
+
+            if (digit_count > 19)
+            {
+                // Keep the first 19 significant digits, the rest only scale the value
+                truncated = true;
+                w = 0;
+                size_t taken = 0;
+                for (const char *c = first; taken < 19; ++c)
+                {
+                    if (*c == '.') continue;
+                    w = w * 10 + static_cast<uint64_t>(*c - '0');
+                    ++taken;
+                }
+
+                exponent += static_cast<int64_t>(digit_count - 19);
+            }
+        }
+
+        // Clinger: both w and 10^|q| are exact doubles, so one operation rounds correctly
+        constexpr double exact_pow10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        if (!truncated && w <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+        {
+            const auto value = static_cast<double>(w);
+            return done(exponent < 0 ? value / exact_pow10[-exponent] : value * exact_pow10[exponent], p);
+        }
+
+        const __binary_float result = __eisel_lemire(exponent, w);
+        if (truncated)
+        {
+            // The dropped digits lie between w and w + 1, both must round the same way
+            if (const __binary_float upper = __eisel_lemire(exponent, w + 1);
+                upper.mantissa != result.mantissa || upper.power2 != result.power2)
+            {
+                double value;
+                if (std::from_chars(s, p, value).ec == std::errc())
+                {
+                    return optional<parsed<double>>::some({value, static_cast<size_t>(p - s)});
+                }
+            }
+        }
+
+        const uint64_t bits = result.mantissa | static_cast<uint64_t>(result.power2) << 52;
+        return done(std::bit_cast<double>(bits), p);
+    }
+
+    static inline optional<parsed<double>> parse_double(const external_string &s) noexcept
+    {
+        return parse_double(s.ptr(), s.size());
+    }
+}
@@ -0,0 +1,543 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "zelix/except/out_of_range.h"
+#include "zelix/memory/system_resource.h"
+#include "zelix/string_utils.h" // Brings in the ZELIX_STL_USE_SIMD detection and dispatch macros
+
+#if defined(ZELIX_STL_X86_DISPATCH) || defined(ZELIX_STL_AVX2_AVAILABLE)
+#   define ZELIX_STL_AVX2_KERNELS
+#endif
+
+namespace zelix::stl::algorithm
+{
+    inline constexpr size_t npos = str::npos; ///< Returned by find when nothing matches
+
+    template <typename Range>
+    using __range_value_t = std::remove_reference_t<decltype(*std::declval<Range &>().data())>;
+
+    /// Element types the vector kernels handle: plain 4 or 8 byte numbers
+    template <typename T>
+    inline constexpr bool __simd_element_v =
+        std::is_trivially_copyable_v<T> && std::is_arithmetic_v<T> &&
+        !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+    /// Element types radix_sort can order by their bit pattern
+    template <typename T>
+    inline constexpr bool __radix_sortable_v =
+        std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool> &&
+        (std::is_integral_v<T> || (std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)));
+
+    /// Result of min_max
+    template <typename T>
+    struct min_max_result
+    {
+        T min;
+        T max;
+    };
+
+    /// True when the AVX2 kernels can run on this machine
+    static inline bool __use_avx2()
+    {
+#   if defined(ZELIX_STL_X86_DISPATCH)
+        static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx2")); // Resolved on first use
+        return supported;
+#   elif defined(ZELIX_STL_AVX2_AVAILABLE)
+        return true;
+#   else
+        return false;
+#   endif
+    }
+
+#   ifdef ZELIX_STL_AVX2_KERNELS
+    /// One bit per element of the 32-byte block at p that equals value
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline uint32_t __eq_mask_avx2(const T *p, const T value)
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p), _mm256_set1_ps(value), _CMP_EQ_OQ)));
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(p), _mm256_set1_pd(value), _CMP_EQ_OQ)));
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            const __m256i eq = _mm256_cmpeq_epi32(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), _mm256_set1_epi32(static_cast<int32_t>(value))
+            );
+            return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+        }
+        else
+        {
+            const __m256i eq = _mm256_cmpeq_epi64(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), _mm256_set1_epi64x(static_cast<int64_t>(value))
+            );
+            return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)));
+        }
+    }
+
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline size_t __find_avx2(const T *data, const size_t n, const T value)
+    {
+        constexpr size_t lanes = 32 / sizeof(T);
+        size_t i = 0;
+
+        // Four blocks per iteration, only pinpoint the lane once something matched
+        for (; i + 4 * lanes <= n; i += 4 * lanes)
+        {
+            const uint32_t m0 = __eq_mask_avx2(data + i, value);
+            const uint32_t m1 = __eq_mask_avx2(data + i + lanes, value);
+            const uint32_t m2 = __eq_mask_avx2(data + i + 2 * lanes, value);
+            const uint32_t m3 = __eq_mask_avx2(data + i + 3 * lanes, value);
+            if ((m0 | m1 | m2 | m3) != 0)
+            {
+                const uint64_t mask = m0 | (m1 << lanes) | (static_cast<uint64_t>(m2) << 2 * lanes) | (static_cast<uint64_t>(m3) << 3 * lanes);
+                return i + __builtin_ctzll(mask);
+            }
+        }
+
+        for (; i + lanes <= n; i += lanes)
+        {
+            if (const uint32_t mask = __eq_mask_avx2(data + i, value))
+            {
+                return i + __builtin_ctz(mask);
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            if (data[i] == value) return i;
+        }
+
+        return npos;
+    }
+
+    template <typename T>
+    ZELIX_STL_TARGET("avx2,popcnt")
+    static inline size_t __count_avx2(const T *data, const size_t n, const T value)
+    {
+        constexpr size_t lanes = 32 / sizeof(T);
+        size_t i = 0;
+        size_t count = 0;
+        for (; i + lanes <= n; i += lanes)
+        {
+            count += __builtin_popcount(__eq_mask_avx2(data + i, value));
+        }
+
+        for (; i < n; ++i)
+        {
+            count += data[i] == value;
+        }
+
+        return count;
+    }
+
+    /// Lane-wise minimum of two blocks of T
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline __m256i __vec_min(const __m256i a, const __m256i b)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+        else if constexpr (std::is_same_v<T, double>)
+            return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+        else if constexpr (std::is_signed_v<T>)
+            return _mm256_min_epi32(a, b);
+        else
+            return _mm256_min_epu32(a, b);
+    }
+
+    /// Lane-wise maximum of two blocks of T
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline __m256i __vec_max(const __m256i a, const __m256i b)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+        else if constexpr (std::is_same_v<T, double>)
+            return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+        else if constexpr (std::is_signed_v<T>)
+            return _mm256_max_epi32(a, b);
+        else
+            return _mm256_max_epu32(a, b);
+    }
+
+    /// AVX2 has lane-wise min/max for these, not for 64-bit integers
+    template <typename T>
+    inline constexpr bool __vec_min_max_v = __simd_element_v<T> && (sizeof(T) == 4 || std::is_same_v<T, double>);
+
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline min_max_result<T> __min_max_avx2(const T *data, const size_t n)
+    {
+        constexpr size_t lanes = 32 / sizeof(T);
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        __m256i hi = lo;
+
+        size_t i = lanes;
+        for (; i + lanes <= n; i += lanes)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            lo = __vec_min<T>(lo, block);
+            hi = __vec_max<T>(hi, block);
+        }
+
+        alignas(32) T lo_lanes[lanes];
+        alignas(32) T hi_lanes[lanes];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lo_lanes), lo);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(hi_lanes), hi);
+
+        min_max_result<T> result{lo_lanes[0], hi_lanes[0]};
+        for (size_t l = 1; l < lanes; ++l)
+        {
+            if (lo_lanes[l] < result.min) result.min = lo_lanes[l];
+            if (result.max < hi_lanes[l]) result.max = hi_lanes[l];
+        }
+
+        for (; i < n; ++i)
+        {
+            if (data[i] < result.min) result.min = data[i];
+            if (result.max < data[i]) result.max = data[i];
+        }
+
+        return result;
+    }
+
+    // Compare-exchange steps of an 8-lane bitonic sort: the partner lane of
+    // each lane, and which lanes keep the larger value. The last three steps
+    // alone merge a bitonic sequence into ascending order
+    alignas(32) inline constexpr int32_t __bitonic_perm[6][8] = {
+        {1, 0, 3, 2, 5, 4, 7, 6},
+        {2, 3, 0, 1, 6, 7, 4, 5},
+        {1, 0, 3, 2, 5, 4, 7, 6},
+        {4, 5, 6, 7, 0, 1, 2, 3},
+        {2, 3, 0, 1, 6, 7, 4, 5},
+        {1, 0, 3, 2, 5, 4, 7, 6},
+    };
+
+    alignas(32) inline constexpr int32_t __bitonic_max[6][8] = {
+        {0, -1, -1, 0, 0, -1, -1, 0},
+        {0, 0, -1, -1, -1, -1, 0, 0},
+        {0, -1, 0, -1, -1, 0, -1, 0},
+        {0, 0, 0, 0, -1, -1, -1, -1},
+        {0, 0, -1, -1, 0, 0, -1, -1},
+        {0, -1, 0, -1, 0, -1, 0, -1},
+    };
+
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline __m256i __bitonic_steps(__m256i v, const size_t first, const size_t last)
+    {
+        for (size_t s = first; s < last; ++s)
+        {
+            const __m256i other = _mm256_permutevar8x32_epi32(v, _mm256_load_si256(reinterpret_cast<const __m256i *>(__bitonic_perm[s])));
+            const __m256i keep_max = _mm256_load_si256(reinterpret_cast<const __m256i *>(__bitonic_max[s]));
+            v = _mm256_blendv_epi8(__vec_min<T>(v, other), __vec_max<T>(v, other), keep_max);
+        }
+
+        return v;
+    }
+
+    /// Sorts up to 16 four-byte elements with two registers of bitonic network
+    template <typename T>
+    ZELIX_STL_TARGET("avx2")
+    static inline void __sort16_avx2(T *data, const size_t n)
+    {
+        // Padding sorts after every real element and is dropped on the way out
+        constexpr T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+        alignas(32) T lanes[16];
+        for (size_t i = 0; i < 16; ++i)
+        {
+            lanes[i] = i < n ? data[i] : pad;
+        }
+
+        __m256i a = __bitonic_steps<T>(_mm256_load_si256(reinterpret_cast<const __m256i *>(lanes)), 0, 6);
+        __m256i b = __bitonic_steps<T>(_mm256_load_si256(reinterpret_cast<const __m256i *>(lanes + 8)), 0, 6);
+
+        // Ascending against descending splits into the low and high halves, each bitonic
+        b = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        const __m256i lo = __bitonic_steps<T>(__vec_min<T>(a, b), 3, 6);
+        const __m256i hi = __bitonic_steps<T>(__vec_max<T>(a, b), 3, 6);
+
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), lo);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes + 8), hi);
+        memcpy(data, lanes, n * sizeof(T));
+    }
+#   endif
+
+    /**
+     * @brief Finds the first element equal to value.
+     *
+     * Four and eight byte numbers are compared a whole AVX2 register at a
+     * time when the CPU supports it and value has the element type; other
+     * needles are compared in their common type, element by element.
+     * @return The index of the match, or npos.
+     */
+    template <typename Range, typename T>
+    size_t find(const Range &range, const T &value)
+    {
+        using E = std::remove_cv_t<__range_value_t<const Range>>;
+        const E *data = range.data();
+        const size_t n = range.size();
+
+#   ifdef ZELIX_STL_AVX2_KERNELS
+        if constexpr (__simd_element_v<E> && std::is_same_v<std::remove_cvref_t<T>, E>)
+        {
+            if (__use_avx2()) return __find_avx2<E>(data, n, value);
+        }
+#   endif
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (data[i] == value) return i;
+        }
+
+        return npos;
+    }
+
+    /**
+     * @brief Counts the elements equal to value.
+     *
+     * Vectorized under the same conditions as find().
+     */
+    template <typename Range, typename T>
+    size_t count(const Range &range, const T &value)
+    {
+        using E = std::remove_cv_t<__range_value_t<const Range>>;
+        const E *data = range.data();
+        const size_t n = range.size();
+
+#   ifdef ZELIX_STL_AVX2_KERNELS
+        if constexpr (__simd_element_v<E> && std::is_same_v<std::remove_cvref_t<T>, E>)
+        {
+            if (__use_avx2()) return __count_avx2<E>(data, n, value);
+        }
+#   endif
+
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            total += data[i] == value;
+        }
+
+        return total;
+    }
+
+    /**
+     * @brief Finds the smallest and largest elements in one pass.
+     *
+     * Where NaNs are present the floating point result is unspecified.
+     * @throws except::out_of_range If the range is empty.
+     */
+    template <typename Range>
+    auto min_max(const Range &range)
+    {
+        using E = std::remove_cv_t<__range_value_t<const Range>>;
+        const E *data = range.data();
+        const size_t n = range.size();
+        if (n == 0) throw except::out_of_range("min_max of an empty range");
+
+#   ifdef ZELIX_STL_AVX2_KERNELS
+        if constexpr (__vec_min_max_v<E>)
+        {
+            if (n >= 32 / sizeof(E) && __use_avx2()) return __min_max_avx2<E>(data, n);
+        }
+#   endif
+
+        min_max_result<E> result{data[0], data[0]};
+        for (size_t i = 1; i < n; ++i)
+        {
+            if (data[i] < result.min) result.min = data[i];
+            if (result.max < data[i]) result.max = data[i];
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Index of the first element not less than value in a sorted range.
+     *
+     * The search halves the range with a conditional move instead of a
+     * branch, so the loop runs log2(n) fixed iterations with nothing to
+     * mispredict; both candidate midpoints of the next step are prefetched.
+     */
+    template <typename Range, typename T>
+    size_t lower_bound(const Range &range, const T &value)
+    {
+        const auto *const data = range.data();
+        size_t n = range.size();
+        if (n == 0) return 0;
+
+        const auto *base = data;
+        while (n > 1)
+        {
+            const size_t half = n / 2;
+#       if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+#       endif
+            base = base[half] < value ? base + half : base;
+            n -= half;
+        }
+
+        return static_cast<size_t>(base - data) + (*base < value);
+    }
+
+    /// Maps a number to an unsigned key with the same order
+    template <typename T>
+    static inline auto __radix_key(const T value)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            constexpr U sign = U(1) << (sizeof(T) * 8 - 1);
+
+            U bits;
+            memcpy(&bits, &value, sizeof(T));
+
+            // Negative numbers order backwards, flip them whole; positive ones just move above
+            return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            using U = std::make_unsigned_t<T>;
+            return static_cast<U>(static_cast<U>(value) ^ (U(1) << (sizeof(T) * 8 - 1)));
+        }
+        else
+        {
+            return value;
+        }
+    }
+
+    /**
+     * @brief Sorts integers or floats ascending with an LSD radix sort, one byte per pass.
+     *
+     * Every histogram is built in a single read of the input, and passes
+     * over a byte all keys share are skipped, so small values in wide types
+     * only pay for the bytes they use.
+     */
+    template <typename T>
+    void radix_sort(T *data, const size_t n)
+    {
+        static_assert(__radix_sortable_v<T>, "radix_sort needs an integer or floating point element type");
+        if (n < 2) return;
+
+        constexpr size_t passes = sizeof(T);
+        size_t counts[passes][256] = {};
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto key = __radix_key(data[i]);
+            for (size_t p = 0; p < passes; ++p)
+            {
+                counts[p][(key >> (p * 8)) & 0xFF]++;
+            }
+        }
+
+        T *buffer = memory::system_array_resource<T>::allocate(n);
+        T *src = data;
+        T *dst = buffer;
+        for (size_t p = 0; p < passes; ++p)
+        {
+            size_t *count = counts[p];
+            if (count[(__radix_key(src[0]) >> (p * 8)) & 0xFF] == n) continue;
+
+            size_t offset = 0;
+            for (size_t d = 0; d < 256; ++d)
+            {
+                const size_t c = count[d];
+                count[d] = offset;
+                offset += c;
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                dst[count[(__radix_key(src[i]) >> (p * 8)) & 0xFF]++] = src[i];
+            }
+
+            T *tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+
+        if (src != data) memcpy(data, src, n * sizeof(T));
+        memory::system_array_resource<T>::deallocate(buffer);
+    }
+
+    template <typename Range>
+    void radix_sort(Range &range)
+    {
+        radix_sort(range.data(), range.size());
+    }
+
+    /// Inputs below this size go to a comparison sort instead of radix_sort
+    inline constexpr size_t __radix_threshold = 256;
+
+    /**
+     * @brief Sorts numbers ascending with the fastest kernel for their size.
+     *
+     * Up to 16 four-byte elements go through an AVX2 bitonic network, short
+     * inputs through std::sort and the rest through radix_sort.
+     */
+    template <typename T>
+    void __sort_numbers(T *data, const size_t n)
+    {
+        if (n < 2) return;
+
+#   ifdef ZELIX_STL_AVX2_KERNELS
+        if constexpr (__simd_element_v<T> && sizeof(T) == 4)
+        {
+            if (n <= 16 && __use_avx2())
+            {
+                __sort16_avx2<T>(data, n);
+                return;
+            }
+        }
+#   endif
+
+        if (n < __radix_threshold)
+        {
+            std::sort(data, data + n);
+            return;
+        }
+
+        radix_sort(data, n);
+    }
+}
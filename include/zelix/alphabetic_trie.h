@@ -107,7 +107,7 @@ namespace zelix::stl
                 }
                 else
                 {
-                    return tolower(ch) - 'a';
+                    return str::to_lower_ascii(ch) - 'a';
                 }
             }
 
@@ -0,0 +1,862 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/4/25.
+//
+
+#pragma once
+#include <cstring>
+#include <type_traits>
+
+#include "forward.h"
+#include "move.h"
+#include "range.h"
+#include "except/element_not_found.h"
+#include "memory/monotonic.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        template <typename Key>
+        struct __btree_key
+        {
+            Key key;
+
+            explicit __btree_key(const Key &k) : key(k) {}
+        };
+
+        template <typename Key, typename Value>
+        struct __btree_pair
+        {
+            Key key;
+            Value value;
+
+            __btree_pair(const Key &k, const Value &v) : key(k), value(v) {}
+        };
+
+        // Raw-storage helpers; node arrays only hold constructed objects in [0, count)
+        template <typename T>
+        void __btree_shift_right(T *arr, const size_t from, const size_t count)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                memmove(static_cast<void *>(arr + from + 1), arr + from, (count - from) * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = count; i > from; --i)
+                {
+                    new (&arr[i]) T(stl::move(arr[i - 1]));
+                    arr[i - 1].~T();
+                }
+            }
+        }
+
+        template <typename T>
+        void __btree_shift_left(T *arr, const size_t from, const size_t count)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                memmove(static_cast<void *>(arr + from), arr + from + 1, (count - from - 1) * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = from; i + 1 < count; ++i)
+                {
+                    new (&arr[i]) T(stl::move(arr[i + 1]));
+                    arr[i + 1].~T();
+                }
+            }
+        }
+
+        template <typename T>
+        void __btree_relocate(T *dst, T *src, const size_t n)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                memcpy(static_cast<void *>(dst), src, n * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    new (&dst[i]) T(stl::move(src[i]));
+                    src[i].~T();
+                }
+            }
+        }
+
+        template <typename Entry, size_t Capacity>
+        struct __btree_leaf
+        {
+            alignas(Entry) unsigned char storage[Capacity * sizeof(Entry)];
+            size_t count = 0;
+            __btree_leaf *next = nullptr;
+            __btree_leaf *prev = nullptr;
+
+            Entry *entries()
+            {
+                return reinterpret_cast<Entry *>(storage);
+            }
+
+            ~__btree_leaf()
+            {
+                if constexpr (!std::is_trivially_destructible_v<Entry>)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        entries()[i].~Entry();
+                    }
+                }
+            }
+        };
+
+        template <typename Key, size_t Capacity>
+        struct __btree_inner
+        {
+            alignas(Key) unsigned char storage[Capacity * sizeof(Key)];
+            void *children[Capacity + 1] = {}; ///< Leaves or inner nodes, depending on the level
+            size_t count = 0; ///< Number of separator keys
+
+            Key *keys()
+            {
+                return reinterpret_cast<Key *>(storage);
+            }
+
+            ~__btree_inner()
+            {
+                if constexpr (!std::is_trivially_destructible_v<Key>)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        keys()[i].~Key();
+                    }
+                }
+            }
+        };
+
+        /// Default number of entries per node: about 512 bytes of payload, clamped to [16, 64] and kept even
+        template <typename Entry>
+        inline constexpr size_t __btree_default_capacity =
+            (512 / sizeof(Entry) < 16 ? 16 : 512 / sizeof(Entry) > 64 ? 64 : 512 / sizeof(Entry)) & ~size_t(1);
+
+        template <typename Key, typename Value, bool IsPair>
+        using __btree_entry = std::conditional_t<IsPair, __btree_pair<Key, Value>, __btree_key<Key>>;
+
+        /**
+         * @brief B+ tree storing many sorted entries per node.
+         *
+         * Entries live only in the leaves, which are chained together so that
+         * in-order iteration is a linear scan over contiguous arrays. Inner nodes
+         * hold separator keys and child pointers; every key in child i+1 is
+         * greater than or equal to separator i.
+         *
+         * @tparam T Key type.
+         * @tparam Value Value type (only used when IsPair is true).
+         * @tparam IsPair Whether entries carry a value.
+         * @tparam NodeCapacity Maximum number of entries (or separators) per node.
+         * @tparam LeafAllocator Allocator for leaf nodes.
+         * @tparam InnerAllocator Allocator for inner nodes.
+         */
+        template <
+            typename T,
+            typename Value = float,
+            bool IsPair = false,
+            size_t NodeCapacity = __btree_default_capacity<__btree_entry<T, Value, IsPair>>,
+            typename LeafAllocator = memory::monotonic_resource<
+                __btree_leaf<__btree_entry<T, Value, IsPair>, NodeCapacity>
+            >,
+            typename InnerAllocator = memory::monotonic_resource<__btree_inner<T, NodeCapacity>>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<
+                    memory::resource<__btree_leaf<__btree_entry<T, Value, IsPair>, NodeCapacity>>,
+                    LeafAllocator
+                >
+            >,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::resource<__btree_inner<T, NodeCapacity>>, InnerAllocator>
+            >
+        >
+        class btree
+        {
+            static_assert(NodeCapacity >= 4 && NodeCapacity % 2 == 0, "Node capacity must be even and at least 4");
+
+        public:
+            using value_type = __btree_entry<T, Value, IsPair>;
+            using pointer = value_type *;
+            using reference = value_type &;
+            using leaf = __btree_leaf<value_type, NodeCapacity>;
+            using inner = __btree_inner<T, NodeCapacity>;
+
+            /**
+             * @brief Bidirectional iterator over the entries in key order.
+             *
+             * Holds a pointer to its tree (tree_) so that --end() can find the
+             * last entry; moving the tree invalidates its iterators.
+             */
+            class iterator
+            {
+            public:
+                iterator(btree *tree, leaf *node, const size_t index) : tree_(tree), node_(node), index_(index) {}
+
+                reference operator*() const
+                {
+                    return node_->entries()[index_];
+                }
+
+                pointer operator->() const
+                {
+                    return node_->entries() + index_;
+                }
+
+                iterator &operator++()
+                {
+                    if (++index_ == node_->count)
+                    {
+                        node_ = node_->next;
+                        index_ = 0;
+                    }
+
+                    return *this;
+                }
+
+                iterator operator++(int)
+                {
+                    iterator tmp = *this;
+                    ++(*this);
+                    return tmp;
+                }
+
+                iterator &operator--()
+                {
+                    if (!node_)
+                    {
+                        // Step back from end() onto the last entry
+                        node_ = tree_->last_leaf();
+                        index_ = node_->count;
+                    }
+                    else if (index_ == 0)
+                    {
+                        node_ = node_->prev;
+                        index_ = node_->count;
+                    }
+
+                    --index_;
+                    return *this;
+                }
+
+                iterator operator--(int)
+                {
+                    iterator tmp = *this;
+                    --(*this);
+                    return tmp;
+                }
+
+                bool operator==(const iterator &other) const
+                {
+                    return node_ == other.node_ && index_ == other.index_;
+                }
+
+                bool operator!=(const iterator &other) const
+                {
+                    return !(*this == other);
+                }
+
+            private:
+                btree *tree_;
+                leaf *node_;
+                size_t index_;
+            };
+
+            btree() = default;
+
+            btree(const btree &) = delete;
+            btree &operator=(const btree &) = delete;
+
+            btree(btree &&other) noexcept :
+                root_(other.root_), first_(other.first_), height_(other.height_), len_(other.len_)
+            {
+                other.root_ = nullptr;
+                other.first_ = nullptr;
+                other.height_ = 0;
+                other.len_ = 0;
+            }
+
+            ~btree()
+            {
+                clear();
+            }
+
+            // Insert a key (duplicates are ignored)
+            template <bool B = IsPair, typename = std::enable_if_t<!B>>
+            void insert(const T &key)
+            {
+                unified_insert(key);
+            }
+
+            template <bool B = IsPair, typename = std::enable_if_t<B>>
+            void insert(const T &key, const Value &value)
+            {
+                unified_insert(key, value);
+            }
+
+            // Remove a key (if present)
+            bool erase(const T &key)
+            {
+                if (!root_) return false;
+
+                // Record the path so underflows can be repaired bottom-up
+                inner *path[max_height];
+                size_t slots[max_height];
+                void *node = root_;
+                for (size_t level = 0; level < height_; ++level)
+                {
+                    auto in = static_cast<inner *>(node);
+                    const size_t i = child_index(in, key);
+                    path[level] = in;
+                    slots[level] = i;
+                    node = in->children[i];
+                }
+
+                auto lf = static_cast<leaf *>(node);
+                const size_t pos = lower_bound(lf, key);
+                if (pos == lf->count || key < lf->entries()[pos].key)
+                {
+                    return false;
+                }
+
+                lf->entries()[pos].~value_type();
+                __btree_shift_left(lf->entries(), pos, lf->count);
+                --lf->count;
+                --len_;
+
+                if (height_ == 0)
+                {
+                    if (lf->count == 0)
+                    {
+                        LeafAllocator::deallocate(lf);
+                        root_ = nullptr;
+                        first_ = nullptr;
+                    }
+
+                    return true;
+                }
+
+                if (lf->count >= min_count)
+                {
+                    return true;
+                }
+
+                bool underflow = fix_leaf(path[height_ - 1], slots[height_ - 1], lf);
+                for (size_t level = height_ - 1; underflow && level > 0; --level)
+                {
+                    underflow = fix_inner(path[level - 1], slots[level - 1], path[level]);
+                }
+
+                // Collapse an empty root
+                if (auto r = static_cast<inner *>(root_); r->count == 0)
+                {
+                    root_ = r->children[0];
+                    InnerAllocator::deallocate(r);
+                    --height_;
+                }
+
+                return true;
+            }
+
+            // Check if a key exists in the tree
+            bool contains(const T &key) const
+            {
+                return find_ptr(key) != nullptr;
+            }
+
+            // Find the entry with the given key, or end() if it is not present
+            iterator find(const T &key)
+            {
+                leaf *lf = const_cast<leaf *>(find_leaf(key));
+                if (lf)
+                {
+                    const size_t pos = lower_bound(lf, key);
+                    if (pos < lf->count && !(key < lf->entries()[pos].key))
+                    {
+                        return iterator(this, lf, pos);
+                    }
+                }
+
+                return end();
+            }
+
+            // Find the entry with the given key, or nullptr if it is not present
+            pointer find_ptr(const T &key) const
+            {
+                leaf *lf = const_cast<leaf *>(find_leaf(key));
+                if (lf)
+                {
+                    const size_t pos = lower_bound(lf, key);
+                    if (pos < lf->count && !(key < lf->entries()[pos].key))
+                    {
+                        return lf->entries() + pos;
+                    }
+                }
+
+                return nullptr;
+            }
+
+            // First entry whose key is not less than key, or end()
+            iterator lower_bound(const T &key)
+            {
+                leaf *lf = const_cast<leaf *>(find_leaf(key));
+                if (!lf) return end();
+                return iterator_at(lf, lower_bound(lf, key));
+            }
+
+            // First entry whose key is greater than key, or end()
+            iterator upper_bound(const T &key)
+            {
+                leaf *lf = const_cast<leaf *>(find_leaf(key));
+                if (!lf) return end();
+
+                auto entries = lf->entries();
+                size_t lo = 0, hi = lf->count;
+                while (lo < hi)
+                {
+                    const size_t mid = (lo + hi) / 2;
+                    if (key < entries[mid].key) hi = mid;
+                    else lo = mid + 1;
+                }
+
+                return iterator_at(lf, lo);
+            }
+
+            // Entries whose key is equal to key (at most one, since keys are unique)
+            iterator_range<iterator> equal_range(const T &key)
+            {
+                return iterator_range<iterator>(lower_bound(key), upper_bound(key));
+            }
+
+            // Entries whose key lies in [from, to)
+            iterator_range<iterator> range(const T &from, const T &to)
+            {
+                if (!(from < to)) return iterator_range<iterator>(end(), end());
+                return iterator_range<iterator>(lower_bound(from), lower_bound(to));
+            }
+
+            // Find the entry with the given key
+            pointer search(const T &key) const
+            {
+                if (pointer entry = find_ptr(key))
+                {
+                    return entry;
+                }
+
+                throw except::element_not_found();
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return len_;
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return len_ == 0;
+            }
+
+            // Remove every entry and release all nodes
+            void clear()
+            {
+                if (root_)
+                {
+                    release(root_, height_);
+                }
+
+                root_ = nullptr;
+                first_ = nullptr;
+                height_ = 0;
+                len_ = 0;
+            }
+
+            iterator begin()
+            {
+                return iterator(this, first_, 0);
+            }
+
+            iterator end()
+            {
+                return iterator(this, nullptr, 0);
+            }
+
+        private:
+            static constexpr size_t min_count = NodeCapacity / 2;
+            static constexpr size_t max_height = 32; // Minimum fan-out of 3 makes this unreachable
+
+            void *root_ = nullptr; // Leaf when height_ is 0, inner node otherwise
+            leaf *first_ = nullptr; // Leftmost leaf
+            size_t height_ = 0; // Number of inner levels
+            size_t len_ = 0; // Number of entries
+
+            static size_t lower_bound(const leaf *lf, const T &key)
+            {
+                auto entries = const_cast<leaf *>(lf)->entries();
+                size_t lo = 0, hi = lf->count;
+                while (lo < hi)
+                {
+                    const size_t mid = (lo + hi) / 2;
+                    if (entries[mid].key < key) lo = mid + 1;
+                    else hi = mid;
+                }
+
+                return lo;
+            }
+
+            // Index of the child whose range contains key (number of separators <= key)
+            static size_t child_index(const inner *in, const T &key)
+            {
+                auto keys = const_cast<inner *>(in)->keys();
+                size_t lo = 0, hi = in->count;
+                while (lo < hi)
+                {
+                    const size_t mid = (lo + hi) / 2;
+                    if (key < keys[mid]) hi = mid;
+                    else lo = mid + 1;
+                }
+
+                return lo;
+            }
+
+            // Position pos of lf, stepping to the next leaf when pos is one past its end
+            iterator iterator_at(leaf *lf, const size_t pos)
+            {
+                if (pos == lf->count) return iterator(this, lf->next, 0);
+                return iterator(this, lf, pos);
+            }
+
+            // Rightmost leaf, or null when the tree is empty
+            leaf *last_leaf() const
+            {
+                void *node = root_;
+                if (!node) return nullptr;
+
+                for (size_t level = 0; level < height_; ++level)
+                {
+                    auto in = static_cast<inner *>(node);
+                    node = in->children[in->count];
+                }
+
+                return static_cast<leaf *>(node);
+            }
+
+            const leaf *find_leaf(const T &key) const
+            {
+                const void *node = root_;
+                if (!node) return nullptr;
+
+                for (size_t level = 0; level < height_; ++level)
+                {
+                    auto in = static_cast<const inner *>(node);
+                    node = in->children[child_index(in, key)];
+                }
+
+                return static_cast<const leaf *>(node);
+            }
+
+            template <typename... Args>
+            void unified_insert(const T &key, Args&&... args)
+            {
+                if (!root_)
+                {
+                    auto lf = LeafAllocator::allocate();
+                    new (lf->entries()) value_type(key, stl::forward<Args>(args)...);
+                    lf->count = 1;
+                    root_ = lf;
+                    first_ = lf;
+                    len_ = 1;
+                    return;
+                }
+
+                inner *path[max_height];
+                size_t slots[max_height];
+                void *node = root_;
+                for (size_t level = 0; level < height_; ++level)
+                {
+                    auto in = static_cast<inner *>(node);
+                    const size_t i = child_index(in, key);
+                    path[level] = in;
+                    slots[level] = i;
+                    node = in->children[i];
+                }
+
+                auto lf = static_cast<leaf *>(node);
+                size_t pos = lower_bound(lf, key);
+                if (pos < lf->count && !(key < lf->entries()[pos].key))
+                {
+                    return; // equal -> ignore duplicate
+                }
+
+                ++len_;
+                if (lf->count < NodeCapacity)
+                {
+                    __btree_shift_right(lf->entries(), pos, lf->count);
+                    new (lf->entries() + pos) value_type(key, stl::forward<Args>(args)...);
+                    ++lf->count;
+                    return;
+                }
+
+                // Split the full leaf in halves, then insert into the right one
+                auto right = LeafAllocator::allocate();
+                __btree_relocate(right->entries(), lf->entries() + min_count, NodeCapacity - min_count);
+                right->count = NodeCapacity - min_count;
+                lf->count = min_count;
+
+                right->next = lf->next;
+                right->prev = lf;
+                if (lf->next) lf->next->prev = right;
+                lf->next = right;
+
+                leaf *target = lf;
+                if (pos > min_count)
+                {
+                    target = right;
+                    pos -= min_count;
+                }
+
+                __btree_shift_right(target->entries(), pos, target->count);
+                new (target->entries() + pos) value_type(key, stl::forward<Args>(args)...);
+                ++target->count;
+
+                // Propagate the new separator upwards
+                T separator = right->entries()[0].key;
+                void *child = right;
+                for (size_t level = height_; level > 0; --level)
+                {
+                    inner *parent = path[level - 1];
+                    const size_t i = slots[level - 1];
+                    if (parent->count < NodeCapacity)
+                    {
+                        __btree_shift_right(parent->keys(), i, parent->count);
+                        new (parent->keys() + i) T(stl::move(separator));
+                        memmove(parent->children + i + 2, parent->children + i + 1,
+                                (parent->count - i) * sizeof(void *));
+                        parent->children[i + 1] = child;
+                        ++parent->count;
+                        return;
+                    }
+
+                    child = split_inner(parent, i, separator, child);
+                }
+
+                // The root itself was split
+                auto root = InnerAllocator::allocate();
+                new (root->keys()) T(stl::move(separator));
+                root->children[0] = root_;
+                root->children[1] = child;
+                root->count = 1;
+                root_ = root;
+                ++height_;
+            }
+
+            /**
+             * Splits a full inner node while inserting (separator, child) at slot i.
+             * On return, separator holds the key pushed up to the parent.
+             */
+            void *split_inner(inner *node, const size_t i, T &separator, void *child)
+            {
+                // Gather the NodeCapacity + 1 keys and NodeCapacity + 2 children in order
+                alignas(T) unsigned char key_storage[(NodeCapacity + 1) * sizeof(T)];
+                void *children[NodeCapacity + 2];
+                auto keys = reinterpret_cast<T *>(key_storage);
+
+                __btree_relocate(keys, node->keys(), i);
+                new (keys + i) T(stl::move(separator));
+                separator.~T();
+                __btree_relocate(keys + i + 1, node->keys() + i, NodeCapacity - i);
+
+                memcpy(children, node->children, (i + 1) * sizeof(void *));
+                children[i + 1] = child;
+                memcpy(children + i + 2, node->children + i + 1, (NodeCapacity - i) * sizeof(void *));
+
+                // Left keeps min_count keys, one moves up, the rest go right
+                auto right = InnerAllocator::allocate();
+                constexpr size_t right_count = NodeCapacity - min_count;
+
+                __btree_relocate(node->keys(), keys, min_count);
+                node->count = min_count;
+                memcpy(node->children, children, (min_count + 1) * sizeof(void *));
+
+                new (&separator) T(stl::move(keys[min_count]));
+                keys[min_count].~T();
+
+                __btree_relocate(right->keys(), keys + min_count + 1, right_count);
+                right->count = right_count;
+                memcpy(right->children, children + min_count + 1, (right_count + 1) * sizeof(void *));
+                return right;
+            }
+
+            /// Repairs an underfull leaf at slot i of parent. Returns whether parent underflowed.
+            bool fix_leaf(inner *parent, const size_t i, leaf *lf)
+            {
+                if (i > 0)
+                {
+                    auto left = static_cast<leaf *>(parent->children[i - 1]);
+                    if (left->count > min_count)
+                    {
+                        // Borrow the largest entry of the left sibling
+                        __btree_shift_right(lf->entries(), 0, lf->count);
+                        __btree_relocate(lf->entries(), left->entries() + left->count - 1, 1);
+                        --left->count;
+                        ++lf->count;
+                        parent->keys()[i - 1] = lf->entries()[0].key;
+                        return false;
+                    }
+
+                    merge_leaves(parent, i - 1, left, lf);
+                }
+                else
+                {
+                    auto right = static_cast<leaf *>(parent->children[i + 1]);
+                    if (right->count > min_count)
+                    {
+                        // Borrow the smallest entry of the right sibling
+                        __btree_relocate(lf->entries() + lf->count, right->entries(), 1);
+                        __btree_shift_left(right->entries(), 0, right->count);
+                        --right->count;
+                        ++lf->count;
+                        parent->keys()[i] = right->entries()[0].key;
+                        return false;
+                    }
+
+                    merge_leaves(parent, i, lf, right);
+                }
+
+                return parent->count < min_count;
+            }
+
+            // Merges right into left and removes separator `sep` from the parent
+            void merge_leaves(inner *parent, const size_t sep, leaf *left, leaf *right)
+            {
+                __btree_relocate(left->entries() + left->count, right->entries(), right->count);
+                left->count += right->count;
+                right->count = 0;
+
+                left->next = right->next;
+                if (right->next) right->next->prev = left;
+
+                remove_separator(parent, sep);
+                LeafAllocator::deallocate(right);
+            }
+
+            /// Repairs an underfull inner node at slot i of parent. Returns whether parent underflowed.
+            bool fix_inner(inner *parent, const size_t i, inner *node)
+            {
+                if (i > 0)
+                {
+                    auto left = static_cast<inner *>(parent->children[i - 1]);
+                    if (left->count > min_count)
+                    {
+                        // Rotate right through the parent
+                        __btree_shift_right(node->keys(), 0, node->count);
+                        __btree_relocate(node->keys(), parent->keys() + i - 1, 1);
+                        memmove(node->children + 1, node->children, (node->count + 1) * sizeof(void *));
+                        node->children[0] = left->children[left->count];
+                        ++node->count;
+
+                        __btree_relocate(parent->keys() + i - 1, left->keys() + left->count - 1, 1);
+                        --left->count;
+                        return false;
+                    }
+
+                    merge_inner(parent, i - 1, left, node);
+                }
+                else
+                {
+                    auto right = static_cast<inner *>(parent->children[i + 1]);
+                    if (right->count > min_count)
+                    {
+                        // Rotate left through the parent
+                        __btree_relocate(node->keys() + node->count, parent->keys() + i, 1);
+                        node->children[node->count + 1] = right->children[0];
+                        ++node->count;
+
+                        __btree_relocate(parent->keys() + i, right->keys(), 1);
+                        __btree_shift_left(right->keys(), 0, right->count);
+                        memmove(right->children, right->children + 1, right->count * sizeof(void *));
+                        --right->count;
+                        return false;
+                    }
+
+                    merge_inner(parent, i, node, right);
+                }
+
+                return parent != root_ ? parent->count < min_count : false;
+            }
+
+            void merge_inner(inner *parent, const size_t sep, inner *left, inner *right)
+            {
+                // Pull the separator down between the two halves
+                new (left->keys() + left->count) T(stl::move(parent->keys()[sep]));
+                __btree_relocate(left->keys() + left->count + 1, right->keys(), right->count);
+                memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(void *));
+                left->count += right->count + 1;
+                right->count = 0;
+
+                remove_separator(parent, sep);
+                InnerAllocator::deallocate(right);
+            }
+
+            // Removes separator sep and the child to its right
+            static void remove_separator(inner *parent, const size_t sep)
+            {
+                parent->keys()[sep].~T();
+                __btree_shift_left(parent->keys(), sep, parent->count);
+                memmove(parent->children + sep + 1, parent->children + sep + 2,
+                        (parent->count - sep - 1) * sizeof(void *));
+                --parent->count;
+            }
+
+            // Recursion depth is bounded by the tree height
+            void release(void *node, const size_t height)
+            {
+                if (height == 0)
+                {
+                    LeafAllocator::deallocate(static_cast<leaf *>(node));
+                    return;
+                }
+
+                auto in = static_cast<inner *>(node);
+                for (size_t i = 0; i <= in->count; ++i)
+                {
+                    release(in->children[i], height - 1);
+                }
+
+                InnerAllocator::deallocate(in);
+            }
+        };
+    } // namespace pmr
+
+    template <typename T>
+    using btree = pmr::btree<T>;
+} // namespace zelix::stl
@@ -0,0 +1,209 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/4/25.
+//
+
+#pragma once
+
+#include "btree.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        /**
+         * \brief A cache-friendly map implementation using a B+ tree.
+         *
+         * Keys are kept sorted in wide nodes, so lookups touch few cache lines and
+         * iteration walks contiguous leaf arrays.
+         *
+         * \tparam Key Type of the key.
+         * \tparam Value Type of the value.
+         * \tparam NodeCapacity Maximum number of entries per node.
+         * \tparam LeafAllocator Allocator for leaf nodes.
+         * \tparam InnerAllocator Allocator for inner nodes.
+         */
+        template<
+            typename Key,
+            typename Value,
+            size_t NodeCapacity = __btree_default_capacity<__btree_pair<Key, Value>>,
+            typename LeafAllocator = memory::monotonic_resource<__btree_leaf<__btree_pair<Key, Value>, NodeCapacity>>,
+            typename InnerAllocator = memory::monotonic_resource<__btree_inner<Key, NodeCapacity>>
+            // No need for SFINAE checks, btree already does that
+        >
+        class btree_map
+        {
+            using tree = btree<Key, Value, true, NodeCapacity, LeafAllocator, InnerAllocator>;
+
+            tree tree_;
+
+        public:
+            /**
+             * \brief Inserts a key-value pair into the map.
+             * \param key The key to insert.
+             * \param value The value to associate with the key.
+             */
+            void insert(const Key &key, const Value &value)
+            {
+                tree_.insert(key, value);
+            }
+
+            /**
+             * \brief Removes a key (and its value) from the map.
+             * \param key The key to remove.
+             * \return True if the key was found and removed, false otherwise.
+             */
+            bool erase(const Key &key)
+            {
+                return tree_.erase(key);
+            }
+
+            /**
+             * \brief Checks if the map contains a given key.
+             * \param key The key to check.
+             * \return True if the key exists, false otherwise.
+             */
+            bool contains(const Key &key) const
+            {
+                return tree_.contains(key);
+            }
+
+            /**
+             * \brief Finds the element associated with a key.
+             * \param key The key to look up.
+             * \return Iterator to the element, or end() if the key does not exist.
+             */
+            tree::iterator find(const Key &key)
+            {
+                return tree_.find(key);
+            }
+
+            /**
+             * \brief Gets the value associated with a key without throwing.
+             * \param key The key to look up.
+             * \return Pointer to the value, or nullptr if the key does not exist.
+             */
+            Value *try_get(const Key &key)
+            {
+                auto entry = tree_.find_ptr(key);
+                return entry ? &entry->value : nullptr;
+            }
+
+            /**
+             * \brief Gets the value associated with a key.
+             * \param key The key to look up.
+             * \return Reference to the value associated with the key.
+             * \throws except::element_not_found if the key does not exist.
+             */
+            Value &get(const Key &key)
+            {
+                return tree_.search(key)->value;
+            }
+
+            /**
+             * \brief Accesses the value associated with a key (operator[]).
+             * \param key The key to look up.
+             * \return Reference to the value associated with the key.
+             */
+            Value &operator[](const Key &key)
+            {
+                return get(key);
+            }
+
+            /**
+             * \brief Returns an iterator to the first element whose key is not less than key.
+             * \param key The key to compare against.
+             * \return Iterator to the element, or end() if there is none.
+             */
+            tree::iterator lower_bound(const Key &key)
+            {
+                return tree_.lower_bound(key);
+            }
+
+            /**
+             * \brief Returns an iterator to the first element whose key is greater than key.
+             * \param key The key to compare against.
+             * \return Iterator to the element, or end() if there is none.
+             */
+            tree::iterator upper_bound(const Key &key)
+            {
+                return tree_.upper_bound(key);
+            }
+
+            /**
+             * \brief Returns the elements equal to key.
+             * \param key The key to look up.
+             * \return A view holding the matching elements (at most one).
+             */
+            iterator_range<typename tree::iterator> equal_range(const Key &key)
+            {
+                return tree_.equal_range(key);
+            }
+
+            /**
+             * \brief Returns a view over the elements whose key lies in [from, to).
+             * \param from Inclusive lower bound.
+             * \param to Exclusive upper bound.
+             * \return A view over the matching elements, in ascending order.
+             */
+            iterator_range<typename tree::iterator> range(const Key &from, const Key &to)
+            {
+                return tree_.range(from, to);
+            }
+
+            /**
+             * \brief Returns an iterator to the beginning of the map.
+             * \return Iterator to the first element.
+             */
+            tree::iterator begin()
+            {
+                return tree_.begin();
+            }
+
+            /**
+             * \brief Returns an iterator to the end of the map.
+             * \return Iterator to one past the last element.
+             */
+            tree::iterator end()
+            {
+                return tree_.end();
+            }
+
+            /**
+             * \brief Returns the number of elements in the map.
+             * \return The size of the map.
+             */
+            size_t size()
+            {
+                return tree_.size();
+            }
+        };
+    } // namespace pmr
+
+    template<typename Key, typename Value>
+    using btree_map = pmr::btree_map<Key, Value>;
+} // namespace zelix::stl
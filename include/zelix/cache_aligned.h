@@ -0,0 +1,93 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+#include "zelix/forward.h"
+#include "zelix/memory/system_resource.h"
+
+namespace zelix::stl
+{
+    /**
+     * \brief Holds a T alone on its own cache line(s).
+     *
+     * The wrapper is aligned to Alignment and padded to a multiple of it,
+     * so two of them side by side (array elements, or neighbouring members
+     * written by different threads such as per-thread counters) never share
+     * a line and never false-share.
+     *
+     * \tparam T The wrapped type.
+     * \tparam Alignment Line size to isolate T on, a power of two.
+     */
+    template <typename T, size_t Alignment = memory::cache_line_size>
+    struct alignas(Alignment) cache_aligned
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+        T value;
+
+        cache_aligned() = default;
+
+        template <typename... Args>
+            requires (!(sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, cache_aligned> && ...)))
+        explicit cache_aligned(Args&&... args) : value(stl::forward<Args>(args)...) {}
+
+        T &get()
+        {
+            return value;
+        }
+
+        [[nodiscard]] const T &get() const
+        {
+            return value;
+        }
+
+        T &operator*()
+        {
+            return value;
+        }
+
+        const T &operator*() const
+        {
+            return value;
+        }
+
+        T *operator->()
+        {
+            return &value;
+        }
+
+        const T *operator->() const
+        {
+            return &value;
+        }
+    };
+}
@@ -0,0 +1,597 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+#include "memory/array_resource.h"
+#include "memory/system_resource.h"
+#include "vector.h"
+#include "zelix/except/invalid_operation.h"
+
+namespace zelix::stl
+{
+    /**
+     * @brief Key fed to the double-array builder, constructible from a string literal.
+     */
+    struct trie_key
+    {
+        const char *ptr = nullptr;
+        size_t size = 0;
+
+        constexpr trie_key() = default;
+
+        constexpr trie_key(const char *p, const size_t n)
+            : ptr(p), size(n)
+        {}
+
+        template <size_t N>
+        constexpr trie_key(const char (&str)[N]) // NOLINT(*-explicit-constructor)
+            : ptr(str), size(N - 1)
+        {}
+
+        [[nodiscard]] constexpr unsigned char at(const size_t i) const
+        {
+            return static_cast<unsigned char>(ptr[i]);
+        }
+    };
+
+    /**
+     * @brief One slot of a double array: a state's base offset and the state owning the slot.
+     *
+     * A transition from state s on byte c leads to t = base[s] + c + 1 when
+     * check[t] == s; the slot at base[s] itself marks s as accepting.
+     */
+    struct __da_cell
+    {
+        int32_t base = 0;
+        int32_t check = -1; ///< Owning state, -1 when free
+    };
+
+    /// Header of a dumped double array; the cells follow it directly
+    struct __da_blob_header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t cells;
+    };
+
+    inline constexpr char __da_magic[8] = {'Z', 'L', 'X', 'D', 'A', 'T', 'R', 'I'};
+    inline constexpr uint32_t __da_version = 1;
+
+    /**
+     * @brief Builds a double array from a key list, usable at compile time.
+     *
+     * Keys are sorted and deduplicated first, then states are laid out in
+     * breadth-first order, each at the first base where all of its labels
+     * land on free slots. All scratch memory is released before returning.
+     */
+    class __da_builder
+    {
+        struct range
+        {
+            int32_t state;
+            size_t begin;
+            size_t end;
+            size_t depth;
+        };
+
+        const trie_key *keys;
+        size_t *order = nullptr; ///< Sorted, unique key indices
+        size_t count = 0;
+        __da_cell *cells = nullptr;
+        size_t capacity = 0;
+        size_t used = 1; ///< One past the highest claimed slot
+        size_t first_free = 1; ///< No free slot below this index
+
+        static constexpr int compare(const trie_key &a, const trie_key &b)
+        {
+            const size_t n = a.size < b.size ? a.size : b.size;
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (a.at(i) != b.at(i)) return a.at(i) < b.at(i) ? -1 : 1;
+            }
+
+            return a.size == b.size ? 0 : a.size < b.size ? -1 : 1;
+        }
+
+        constexpr void sort(size_t *idx, size_t *tmp, const size_t n)
+        {
+            if (n < 2) return;
+
+            const size_t half = n / 2;
+            sort(idx, tmp, half);
+            sort(idx + half, tmp, n - half);
+
+            size_t i = 0, j = half, k = 0;
+            while (i < half && j < n) tmp[k++] = compare(keys[idx[j]], keys[idx[i]]) < 0 ? idx[j++] : idx[i++];
+            while (i < half) tmp[k++] = idx[i++];
+            while (j < n) tmp[k++] = idx[j++];
+            for (k = 0; k < n; ++k) idx[k] = tmp[k];
+        }
+
+        constexpr void reserve(const size_t n)
+        {
+            if (n <= capacity) return;
+
+            size_t grown = capacity * 2;
+            if (grown < n) grown = n;
+
+            auto *next = new __da_cell[grown];
+            for (size_t i = 0; i < capacity; ++i) next[i] = cells[i];
+            delete[] cells;
+            cells = next;
+            capacity = grown;
+        }
+
+        /// Distinct labels of the keys in [begin, end) at depth: 0 for a key ending there, byte + 1 otherwise
+        constexpr size_t labels(const size_t begin, const size_t end, const size_t depth, uint16_t *out) const
+        {
+            size_t n = 0;
+            for (size_t i = begin; i < end; ++i)
+            {
+                const trie_key &key = keys[order[i]];
+                const uint16_t label = key.size == depth ? 0 : static_cast<uint16_t>(key.at(depth) + 1);
+                if (n == 0 || out[n - 1] != label) out[n++] = label;
+            }
+
+            return n;
+        }
+
+        constexpr int32_t find_base(const uint16_t *label, const size_t n)
+        {
+            while (first_free < used && cells[first_free].check != -1) ++first_free;
+
+            for (size_t base = first_free > label[0] ? first_free - label[0] : 1; ; ++base)
+            {
+                if (base == 0) continue;
+
+                reserve(base + label[n - 1] + 1);
+                bool fits = true;
+                for (size_t i = 0; i < n && fits; ++i)
+                {
+                    fits = cells[base + label[i]].check == -1;
+                }
+
+                if (fits) return static_cast<int32_t>(base);
+            }
+        }
+
+    public:
+        constexpr explicit __da_builder(const trie_key *k, const size_t n)
+            : keys(k)
+        {
+            if (n == 0) return;
+
+            order = new size_t[n];
+            auto *tmp = new size_t[n];
+            for (size_t i = 0; i < n; ++i) order[i] = i;
+            sort(order, tmp, n);
+            delete[] tmp;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (count == 0 || compare(keys[order[count - 1]], keys[order[i]]) != 0) order[count++] = order[i];
+            }
+        }
+
+        __da_builder(const __da_builder &) = delete;
+        __da_builder &operator=(const __da_builder &) = delete;
+
+        /// Lays out every state, returns the number of cells
+        constexpr size_t build()
+        {
+            reserve(257);
+            cells[0].check = -2; // Root, never a transition target
+            if (count == 0) return used;
+
+            auto *queue = new range[count + 1];
+            size_t queue_cap = count + 1, head = 0, tail = 0;
+            queue[tail++] = range{0, 0, count, 0};
+
+            uint16_t label[257] = {};
+            while (head != tail)
+            {
+                const range r = queue[head++];
+                const size_t n = labels(r.begin, r.end, r.depth, label);
+                const int32_t base = find_base(label, n);
+                cells[r.state].base = base;
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const size_t slot = base + label[i];
+                    cells[slot].check = r.state;
+                    if (slot + 1 > used) used = slot + 1;
+                }
+
+                // Queue one child state per byte label, over the keys carrying that byte
+                size_t begin = r.begin;
+                if (label[0] == 0) ++begin; // The key ending here sorts first
+
+                for (size_t i = label[0] == 0 ? 1 : 0; i < n; ++i)
+                {
+                    size_t end = begin;
+                    while (end < r.end && keys[order[end]].at(r.depth) + 1 == label[i]) ++end;
+
+                    if (tail == queue_cap)
+                    {
+                        // Compact the consumed front before growing
+                        auto *next = new range[queue_cap * 2];
+                        for (size_t j = head; j < tail; ++j) next[j - head] = queue[j];
+                        delete[] queue;
+                        queue = next;
+                        tail -= head;
+                        head = 0;
+                        queue_cap *= 2;
+                    }
+
+                    queue[tail++] = range{static_cast<int32_t>(base + label[i]), begin, end, r.depth + 1};
+                    begin = end;
+                }
+            }
+
+            delete[] queue;
+            return used;
+        }
+
+        /// Copies the built cells into out, which must hold build() cells
+        constexpr void copy(__da_cell *out) const
+        {
+            for (size_t i = 0; i < used; ++i) out[i] = cells[i];
+        }
+
+        constexpr ~__da_builder()
+        {
+            delete[] order;
+            delete[] cells;
+        }
+    };
+
+    /**
+     * @brief Read-only double-array trie over cells owned elsewhere.
+     *
+     * Lookups walk one cell per byte, so a keyword test touches a handful of
+     * contiguous cache lines. Views are what static_double_array,
+     * double_array_trie and load() all hand out; they are cheap to copy.
+     */
+    class double_array_view
+    {
+        const __da_cell *cells_ = nullptr;
+        size_t size_ = 0;
+
+        /// State reached by following word from the root, or -1
+        [[nodiscard]] constexpr int32_t walk(const char *word, const size_t n) const
+        {
+            if (size_ == 0) return -1;
+
+            int32_t state = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                const size_t next = static_cast<size_t>(cells_[state].base) + static_cast<unsigned char>(word[i]) + 1;
+                if (next >= size_ || cells_[next].check != state) return -1;
+                state = static_cast<int32_t>(next);
+            }
+
+            return state;
+        }
+
+        [[nodiscard]] constexpr bool accepts(const int32_t state) const
+        {
+            const auto slot = static_cast<size_t>(cells_[state].base);
+            return slot < size_ && cells_[slot].check == state;
+        }
+
+    public:
+        constexpr double_array_view() = default;
+
+        constexpr double_array_view(const __da_cell *cells, const size_t size)
+            : cells_(cells), size_(size)
+        {}
+
+        /**
+         * @brief Checks whether the exact key is present.
+         */
+        [[nodiscard]] constexpr bool search(const char *word, const size_t n) const
+        {
+            const int32_t state = walk(word, n);
+            return state >= 0 && accepts(state);
+        }
+
+        /**
+         * @brief Checks whether any key starts with the given bytes.
+         */
+        [[nodiscard]] constexpr bool starts_with(const char *word, const size_t n) const
+        {
+            // Every state lies on the path of at least one key
+            return walk(word, n) >= 0 && (n != 0 || cells_[0].base != 0);
+        }
+
+        /**
+         * @brief Calls fn(const char *key, size_t len) for every key starting with the given bytes, in byte order.
+         */
+        template <typename F>
+        void for_each_prefix(const char *word, const size_t n, F &&fn) const
+        {
+            const int32_t start = walk(word, n);
+            if (start < 0 || (n == 0 && cells_[0].base == 0)) return;
+
+            struct frame
+            {
+                int32_t state;
+                uint16_t label; ///< Next label to try
+            };
+
+            vector<char> key;
+            for (size_t i = 0; i < n; ++i) key.push_back(word[i]);
+
+            vector<frame> stack;
+            stack.push_back(frame{start, 0});
+            while (!stack.empty())
+            {
+                frame &top = stack[stack.size() - 1];
+                if (top.label > 256)
+                {
+                    stack.pop_back();
+                    if (!stack.empty()) key.pop_back();
+                    continue;
+                }
+
+                const uint16_t label = top.label++;
+                const size_t slot = static_cast<size_t>(cells_[top.state].base) + label;
+                if (slot >= size_ || cells_[slot].check != top.state) continue;
+
+                if (label == 0)
+                {
+                    fn(static_cast<const char *>(key.data()), key.size());
+                    continue;
+                }
+
+                key.push_back(static_cast<char>(label - 1));
+                stack.push_back(frame{static_cast<int32_t>(slot), 0});
+            }
+        }
+
+        [[nodiscard]] constexpr size_t cell_count() const
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr const __da_cell *cells() const
+        {
+            return cells_;
+        }
+
+        /// Size in bytes of the blob written by dump()
+        [[nodiscard]] constexpr size_t dump_size() const
+        {
+            return sizeof(__da_blob_header) + size_ * sizeof(__da_cell);
+        }
+
+        /**
+         * @brief Writes the trie as a flat blob that load() can map back without copying.
+         *
+         * @param out Destination of at least dump_size() bytes.
+         */
+        void dump(char *out) const
+        {
+            __da_blob_header header{};
+            memcpy(header.magic, __da_magic, sizeof(__da_magic));
+            header.version = __da_version;
+            header.cells = size_;
+
+            memcpy(out, &header, sizeof(header));
+            if (size_ != 0) memcpy(out + sizeof(header), cells_, size_ * sizeof(__da_cell));
+        }
+
+        /**
+         * @brief Views a blob written by dump(), for example straight out of a mapped_file.
+         *
+         * The blob is used in place and must outlive the view.
+         *
+         * @throws except::invalid_operation If the blob is malformed or misaligned.
+         */
+        static double_array_view load(const char *blob, const size_t size)
+        {
+            __da_blob_header header{};
+            if (size < sizeof(header))
+                throw except::invalid_operation("Double-array blob is truncated");
+
+            memcpy(&header, blob, sizeof(header));
+            if (memcmp(header.magic, __da_magic, sizeof(__da_magic)) != 0 || header.version != __da_version)
+                throw except::invalid_operation("Not a double-array trie blob");
+
+            if (header.cells > (size - sizeof(header)) / sizeof(__da_cell))
+                throw except::invalid_operation("Double-array blob is truncated");
+
+            const char *cells = blob + sizeof(header);
+            if (reinterpret_cast<uintptr_t>(cells) % alignof(__da_cell) != 0)
+                throw except::invalid_operation("Double-array blob is misaligned");
+
+            return {reinterpret_cast<const __da_cell *>(cells), static_cast<size_t>(header.cells)};
+        }
+    };
+
+    /**
+     * @brief Double array with its cells stored inline, built by make_static_trie().
+     */
+    template <size_t Cells>
+    struct static_double_array
+    {
+        __da_cell cells[Cells];
+
+        [[nodiscard]] constexpr double_array_view view() const
+        {
+            return {cells, Cells};
+        }
+
+        [[nodiscard]] constexpr bool search(const char *word, const size_t n) const
+        {
+            return view().search(word, n);
+        }
+
+        [[nodiscard]] constexpr bool starts_with(const char *word, const size_t n) const
+        {
+            return view().starts_with(word, n);
+        }
+    };
+
+    template <const auto &Keys>
+    consteval size_t __da_static_size()
+    {
+        __da_builder builder(Keys, sizeof(Keys) / sizeof(Keys[0]));
+        return builder.build();
+    }
+
+    /**
+     * @brief Builds a double-array trie at compile time.
+     *
+     * Usage:
+     * \code
+     * static constexpr trie_key keywords[] = {"if", "else", "while"};
+     * constexpr auto reserved = make_static_trie<keywords>();
+     * static_assert(reserved.search("else", 4));
+     * \endcode
+     *
+     * @tparam Keys A constexpr array of trie_key with static storage duration.
+     */
+    template <const auto &Keys>
+    consteval auto make_static_trie()
+    {
+        static_double_array<__da_static_size<Keys>()> result{};
+
+        __da_builder builder(Keys, sizeof(Keys) / sizeof(Keys[0]));
+        builder.build();
+        builder.copy(result.cells);
+        return result;
+    }
+
+    namespace pmr
+    {
+        /**
+         * @brief Double-array trie built at runtime and owning its cells.
+         *
+         * Freezes a key set (or a built radix_trie) into a single contiguous
+         * allocation; dump() the view to produce a blob that later runs load()
+         * without rebuilding.
+         *
+         * @tparam Allocator Allocator for the cell array.
+         */
+        template <
+            typename Allocator = memory::system_array_resource<__da_cell>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<__da_cell>, Allocator>
+            >
+        >
+        class double_array_trie
+        {
+            __da_cell *cells_ = nullptr;
+            size_t size_ = 0;
+
+        public:
+            double_array_trie(const trie_key *keys, const size_t n)
+            {
+                __da_builder builder(keys, n);
+                size_ = builder.build();
+                cells_ = Allocator::allocate(size_);
+                builder.copy(cells_);
+            }
+
+            double_array_trie(std::initializer_list<trie_key> keys)
+                : double_array_trie(keys.begin(), keys.size())
+            {}
+
+            /**
+             * @brief Freezes any trie offering for_each(fn(const char *, size_t)), such as radix_trie.
+             */
+            template <typename Trie>
+            static double_array_trie freeze(const Trie &trie)
+            {
+                vector<trie_key> keys;
+                trie.for_each([&keys](const char *key, const size_t len) { keys.push_back(trie_key(key, len)); });
+                return double_array_trie(keys.data(), keys.size());
+            }
+
+            double_array_trie(const double_array_trie &) = delete;
+            double_array_trie &operator=(const double_array_trie &) = delete;
+
+            double_array_trie(double_array_trie &&other) noexcept
+                : cells_(other.cells_), size_(other.size_)
+            {
+                other.cells_ = nullptr;
+                other.size_ = 0;
+            }
+
+            double_array_trie &operator=(double_array_trie &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    if (cells_) Allocator::deallocate(cells_);
+                    cells_ = other.cells_;
+                    size_ = other.size_;
+                    other.cells_ = nullptr;
+                    other.size_ = 0;
+                }
+
+                return *this;
+            }
+
+            [[nodiscard]] double_array_view view() const
+            {
+                return {cells_, size_};
+            }
+
+            [[nodiscard]] bool search(const char *word, const size_t n) const
+            {
+                return view().search(word, n);
+            }
+
+            [[nodiscard]] bool starts_with(const char *word, const size_t n) const
+            {
+                return view().starts_with(word, n);
+            }
+
+            template <typename F>
+            void for_each_prefix(const char *word, const size_t n, F &&fn) const
+            {
+                view().for_each_prefix(word, n, stl::forward<F>(fn));
+            }
+
+            ~double_array_trie()
+            {
+                if (cells_) Allocator::deallocate(cells_);
+            }
+        };
+    }
+
+    using double_array_trie = pmr::double_array_trie<>;
+}
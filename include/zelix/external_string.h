@@ -42,17 +42,15 @@ namespace zelix::stl
         size_t len = 0;
 
     public:
-        external_string()
+        constexpr external_string()
             : buffer(nullptr)
         {}
 
-        external_string(const external_string &other)
-        {
-            buffer = other.buffer;
-            len = other.len;
-        }
+        constexpr external_string(const external_string &other)
+            : buffer(other.buffer), len(other.len)
+        {}
 
-        external_string(const char *buffer, const size_t len)
+        constexpr external_string(const char *buffer, const size_t len)
             : buffer(buffer), len(len)
         {
             if (buffer == nullptr || len == 0)
@@ -65,6 +63,13 @@ namespace zelix::stl
             : buffer(s), len(str::len(s))
         {}
 
+        /// Views a string literal without measuring it, usable in constant expressions
+        template <size_t N>
+        static constexpr external_string literal(const char (&s)[N])
+        {
+            return external_string(s, N - 1);
+        }
+
         bool operator==(const external_string &other) const
         {
             if (len != other.len)
@@ -75,12 +80,12 @@ namespace zelix::stl
             return memcmp(buffer, other.buffer, len) == 0;
         }
 
-        [[nodiscard]] const char *ptr()
+        [[nodiscard]] constexpr const char *ptr()
         const {
             return buffer;
         }
 
-        [[nodiscard]] size_t size()
+        [[nodiscard]] constexpr size_t size()
         const {
             return len;
         }
@@ -98,6 +103,60 @@ namespace zelix::stl
         {
             return len == 0;
         }
+
+        static constexpr size_t npos = str::npos; ///< Returned by find() when nothing matches
+
+        // Index of the first occurrence of needle at or after pos, or npos
+        [[nodiscard]] size_t find(const char *needle, const size_t pos, const size_t needle_len) const
+        {
+            if (pos > len) return npos;
+
+            const size_t idx = str::find(buffer + pos, len - pos, needle, needle_len);
+            return idx == npos ? npos : idx + pos;
+        }
+
+        [[nodiscard]] size_t find(const char *needle, const size_t pos = 0) const
+        {
+            return find(needle, pos, str::len(needle));
+        }
+
+        [[nodiscard]] size_t find(const external_string &needle, const size_t pos = 0) const
+        {
+            return find(needle.buffer, pos, needle.len);
+        }
+
+        [[nodiscard]] size_t find(const char c, const size_t pos = 0) const
+        {
+            if (pos > len) return npos;
+
+            const size_t idx = str::find_char(buffer + pos, len - pos, c);
+            return idx == npos ? npos : idx + pos;
+        }
+
+        [[nodiscard]] bool starts_with(const char *prefix) const
+        {
+            return str::starts_with(buffer, len, prefix, str::len(prefix));
+        }
+
+        [[nodiscard]] bool starts_with(const external_string &prefix) const
+        {
+            return str::starts_with(buffer, len, prefix.buffer, prefix.len);
+        }
+
+        [[nodiscard]] bool ends_with(const char *suffix) const
+        {
+            return str::ends_with(buffer, len, suffix, str::len(suffix));
+        }
+
+        [[nodiscard]] bool ends_with(const external_string &suffix) const
+        {
+            return str::ends_with(buffer, len, suffix.buffer, suffix.len);
+        }
+
+        [[nodiscard]] size_t count(const char c) const
+        {
+            return str::count_char(buffer, len, c);
+        }
     };
 
     struct external_string_hash
@@ -113,7 +172,7 @@ namespace zelix::stl
         size_t operator()(const char* c_str) const
         {
             const size_t len = str::len(c_str);
-            return XXH64(c_str, len, len);
+            return XXH3_64bits(c_str, len); // Must agree with the string overload for heterogeneous lookup
         }
     };
 }
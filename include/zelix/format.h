@@ -0,0 +1,369 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "display.h"
+#include "string_utils.h"
+#include "to_string.h"
+#include "zelix/algorithm/ftoi.h"
+#include "zelix/algorithm/itoa.h"
+#include "zelix/memory/system_resource.h"
+
+namespace zelix::stl
+{
+    /**
+     * \brief A string literal usable as a template argument.
+     *
+     * Lets format strings be parsed while compiling:
+     * `format<"{}: {} ms">(out, name, ms)`.
+     */
+    template <size_t N>
+    struct format_string
+    {
+        char data[N] = {};
+
+        constexpr format_string(const char (&str)[N]) // NOLINT(*-explicit-constructor)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                data[i] = str[i];
+            }
+        }
+
+        static constexpr size_t size = N - 1;
+    };
+
+    /**
+     * \brief A format string split into its literal segments.
+     *
+     * Escapes ("{{", "}}") are resolved up front, so text holds the literal
+     * bytes of every segment back to back and segment i ends at seg_end[i].
+     */
+    template <format_string Fmt>
+    struct __format_spec
+    {
+        struct parsed
+        {
+            char text[Fmt.size + 1] = {};
+            size_t text_len = 0;
+            size_t seg_end[Fmt.size + 1] = {};
+            size_t fields = 0;
+            bool valid = true;
+        };
+
+        static constexpr parsed parse()
+        {
+            parsed p;
+            for (size_t i = 0; i < Fmt.size; ++i)
+            {
+                const char c = Fmt.data[i];
+                const char next = i + 1 < Fmt.size ? Fmt.data[i + 1] : '\0';
+
+                if (c == '{' && next == '}')
+                {
+                    p.seg_end[p.fields++] = p.text_len;
+                    ++i;
+                }
+                else if ((c == '{' || c == '}') && next == c)
+                {
+                    p.text[p.text_len++] = c;
+                    ++i;
+                }
+                else if (c == '{' || c == '}')
+                {
+                    p.valid = false;
+                }
+                else
+                {
+                    p.text[p.text_len++] = c;
+                }
+            }
+
+            p.seg_end[p.fields] = p.text_len;
+            return p;
+        }
+
+        static constexpr parsed value = parse();
+        static_assert(value.valid, "Invalid format string, only {} fields and {{ }} escapes are supported");
+
+        template <size_t I>
+        static constexpr size_t seg_begin = I == 0 ? 0 : value.seg_end[I - 1];
+
+        template <size_t I>
+        static constexpr size_t seg_size = value.seg_end[I] - seg_begin<I>;
+    };
+
+    /// A borrowed run of characters
+    struct __format_text
+    {
+        const char *ptr;
+        size_t size;
+    };
+
+    template <typename T>
+    inline constexpr bool __is_format_int128_v =
+#   ifdef __SIZEOF_INT128__
+        std::is_same_v<T, __int128> || std::is_same_v<T, unsigned __int128>;
+#   else
+        false;
+#   endif
+
+    /// Turns an argument into something with a known width bound
+    template <typename T>
+    static inline auto __format_prepare(const T &val)
+    {
+        using U = std::remove_cvref_t<T>;
+        if constexpr (
+            (std::is_arithmetic_v<U> && !std::is_same_v<U, long double>) ||
+            std::is_same_v<U, algorithm::fixed> ||
+            __is_format_int128_v<U>
+        )
+        {
+            return val;
+        }
+        else if constexpr (std::is_same_v<U, long double>)
+        {
+            return static_cast<double>(val);
+        }
+        else if constexpr (std::is_convertible_v<const U &, const char *>)
+        {
+            const char *str = val;
+            return __format_text{str, str::len(str)};
+        }
+        else if constexpr (requires (U &v) { v.ptr(); v.size(); })
+        {
+            // Owned strings only expose ptr() as non-const, it does not mutate
+            auto &v = const_cast<U &>(val);
+            return __format_text{v.ptr(), v.size()};
+        }
+        else if constexpr (std::is_base_of_v<display, U>)
+        {
+            return val.serialize();
+        }
+        else
+        {
+            U copy = val;
+            return serialize(stl::move(copy));
+        }
+    }
+
+    /// Upper bound of the characters a prepared argument writes
+    template <typename P>
+    static inline size_t __format_width(const P &piece)
+    {
+        if constexpr (std::is_same_v<P, __format_text>)
+        {
+            return piece.size;
+        }
+        else if constexpr (std::is_same_v<P, bool>)
+        {
+            return 5;
+        }
+        else if constexpr (std::is_same_v<P, char>)
+        {
+            return 1;
+        }
+        else if constexpr (std::is_floating_point_v<P>)
+        {
+            return algorithm::max_shortest_chars;
+        }
+        else if constexpr (__is_format_int128_v<P>)
+        {
+            return algorithm::max_int128_chars;
+        }
+        else if constexpr (std::is_integral_v<P>)
+        {
+            return algorithm::max_integer_chars;
+        }
+        else if constexpr (std::is_same_v<P, algorithm::fixed>)
+        {
+            // Sign, integer digits, point, decimals and dtoi's terminator
+            const double mag = piece.value < 0 ? -piece.value : piece.value;
+            const int decimals = piece.decimals < 0 ? 0 : piece.decimals;
+            const size_t int_digits = mag < 1e17 ? 17 : 309;
+            return 3 + int_digits + static_cast<size_t>(
+                decimals > algorithm::max_fixed_decimals ? algorithm::max_fixed_decimals : decimals
+            );
+        }
+        else
+        {
+            return piece.size(); // Serialized string
+        }
+    }
+
+    template <typename P>
+    static inline char *__format_put(char *out, const P &piece)
+    {
+        if constexpr (std::is_same_v<P, __format_text>)
+        {
+            if (piece.size != 0) memcpy(out, piece.ptr, piece.size);
+            return out + piece.size;
+        }
+        else if constexpr (std::is_same_v<P, bool>)
+        {
+            if (piece)
+            {
+                memcpy(out, "true", 4);
+                return out + 4;
+            }
+
+            memcpy(out, "false", 5);
+            return out + 5;
+        }
+        else if constexpr (std::is_same_v<P, char>)
+        {
+            *out = piece;
+            return out + 1;
+        }
+        else if constexpr (std::is_same_v<P, double>)
+        {
+            return out + algorithm::dtoa(out, piece);
+        }
+        else if constexpr (std::is_same_v<P, float>)
+        {
+            return out + algorithm::ftoa(out, piece);
+        }
+        else if constexpr (std::is_integral_v<P> || __is_format_int128_v<P>)
+        {
+            return out + algorithm::itoa(piece, out);
+        }
+        else if constexpr (std::is_same_v<P, algorithm::fixed>)
+        {
+            return out + algorithm::dtoi(out, piece.value, piece.decimals);
+        }
+        else
+        {
+            auto &str = const_cast<P &>(piece);
+            if (str.size() != 0) memcpy(out, str.ptr(), str.size());
+            return out + str.size();
+        }
+    }
+
+    template <typename Spec, size_t I>
+    static inline char *__format_segment(char *out)
+    {
+        constexpr size_t size = Spec::template seg_size<I>;
+        if constexpr (size != 0)
+        {
+            memcpy(out, Spec::value.text + Spec::template seg_begin<I>, size);
+        }
+
+        return out + size;
+    }
+
+    template <typename Spec, size_t... I, typename... P>
+    static inline char *__format_all(char *out, std::index_sequence<I...>, const P &...pieces)
+    {
+        ((out = __format_put(__format_segment<Spec, I>(out), pieces)), ...);
+        return __format_segment<Spec, sizeof...(I)>(out);
+    }
+
+    template <format_string Fmt, typename... P>
+    static inline size_t __format_bound(const P &...pieces)
+    {
+        return __format_spec<Fmt>::value.text_len + (__format_width(pieces) + ... + 0);
+    }
+
+    template <format_string Fmt, typename... P>
+    static inline size_t __format_prepared(char *buffer, const P &...pieces)
+    {
+        using spec = __format_spec<Fmt>;
+        static_assert(
+            spec::value.fields == sizeof...(P),
+            "Number of format arguments does not match the {} fields"
+        );
+
+        return __format_all<spec>(buffer, std::index_sequence_for<P...>{}, pieces...) - buffer;
+    }
+
+    /**
+     * @brief Upper bound of the bytes format_to writes for these arguments.
+     */
+    template <format_string Fmt, typename... Args>
+    static inline size_t format_bound(const Args &...args)
+    {
+        return __format_bound<Fmt>(__format_prepare(args)...);
+    }
+
+    /**
+     * @brief Formats args into buffer, replacing each {} in Fmt in order.
+     *
+     * The buffer must hold format_bound<Fmt>(args...) bytes. No terminator is
+     * written unless the last field is an algorithm::fixed.
+     * @return Number of characters written.
+     */
+    template <format_string Fmt, typename... Args>
+    static inline size_t format_to(char *buffer, const Args &...args)
+    {
+        return __format_prepared<Fmt>(buffer, __format_prepare(args)...);
+    }
+
+    /**
+     * @brief Formats args straight into a stream's buffer.
+     *
+     * The literal segments of Fmt are split out at compile time and the
+     * widest each field can get is summed up front, so a stream with
+     * reserve()/commit() (ostream, fd_ostream) is checked for room once and
+     * then written without any per-argument bounds checks. Other streams,
+     * or output larger than their buffer, get it through a single write(),
+     * which keeps a concurrent_ostream line in one record.
+     */
+    template <format_string Fmt, typename Stream, typename... Args>
+    static inline Stream &format(Stream &stream, const Args &...args)
+    {
+        return [&]<typename... P>(const P &...pieces) -> Stream &
+        {
+            const size_t bound = __format_bound<Fmt>(pieces...);
+            if constexpr (requires { stream.reserve(bound); stream.commit(bound); })
+            {
+                if (char *out = stream.reserve(bound))
+                {
+                    stream.commit(__format_prepared<Fmt>(out, pieces...));
+                    return stream;
+                }
+            }
+
+            char local[512];
+            char *buffer = bound <= sizeof(local) ? local : memory::system_array_resource<char>::allocate(bound);
+            stream.write(buffer, __format_prepared<Fmt>(buffer, pieces...));
+
+            if (buffer != local)
+            {
+                memory::system_array_resource<char>::deallocate(buffer);
+            }
+
+            return stream;
+        }(__format_prepare(args)...);
+    }
+}
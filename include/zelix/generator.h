@@ -0,0 +1,162 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <coroutine>
+#include <exception>
+
+#include "move.h"
+#include "optional.h"
+
+namespace zelix::stl
+{
+    /**
+     * \brief Lazily evaluated sequence produced by a C++20 coroutine.
+     *
+     * Each co_yield suspends the coroutine until the next element is asked
+     * for. Besides next(), a generator can fill a buffer chunk-wise, which is
+     * the producer shape producer_stream expects.
+     *
+     * \code
+     * generator<token> lex(const char *src)
+     * {
+     *     while (*src) co_yield scan(src);
+     * }
+     * \endcode
+     *
+     * \tparam T Type of the yielded elements.
+     */
+    template <typename T>
+    class generator
+    {
+    public:
+        struct promise_type
+        {
+            optional<T> current; ///< Last yielded element, consumed by next()
+            std::exception_ptr error;
+
+            generator get_return_object()
+            {
+                return generator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            template <typename U = T>
+            std::suspend_always yield_value(U &&value)
+            {
+                current = optional<T>::emplace(stl::forward<U>(value));
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception()
+            {
+                error = std::current_exception();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+
+        explicit generator(const std::coroutine_handle<promise_type> handle)
+            : handle_(handle)
+        {}
+
+    public:
+        generator(const generator &) = delete;
+        generator &operator=(const generator &) = delete;
+
+        generator(generator &&other) noexcept
+            : handle_(other.handle_)
+        {
+            other.handle_ = nullptr;
+        }
+
+        generator &operator=(generator &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (handle_) handle_.destroy();
+                handle_ = other.handle_;
+                other.handle_ = nullptr;
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Runs the coroutine up to its next co_yield.
+         *
+         * \param out Receives the yielded element.
+         * \return false once the coroutine has finished.
+         * \throws Whatever the coroutine body threw.
+         */
+        bool next(T &out)
+        {
+            if (!handle_ || handle_.done()) return false;
+
+            handle_.resume();
+            if (handle_.promise().error)
+            {
+                std::rethrow_exception(stl::move(handle_.promise().error));
+            }
+
+            if (handle_.done()) return false;
+
+            out = stl::move(handle_.promise().current.get());
+            handle_.promise().current = optional<T>::none();
+            return true;
+        }
+
+        /**
+         * \brief Fills up to max elements, returning how many were produced (0 once finished).
+         */
+        size_t operator()(T *out, const size_t max)
+        {
+            size_t n = 0;
+            while (n < max && next(out[n])) ++n;
+            return n;
+        }
+
+        ~generator()
+        {
+            if (handle_) handle_.destroy();
+        }
+    };
+}
@@ -0,0 +1,809 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/2/25.
+//
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include "forward.h"
+#include "memory.h"
+#include "move.h"
+#include "probe.h"
+#include "string_equality.h"
+#include "string_utils.h"
+#include "except/element_not_found.h"
+#include "memory/array_resource.h"
+#include "memory/system_resource.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        template <typename Key, typename Value>
+        struct __hash_slot
+        {
+            Key key;
+            Value value;
+
+            template <typename K, typename... Args>
+            explicit __hash_slot(K &&k, Args&&... args) :
+                key(stl::forward<K>(k)), value(stl::forward<Args>(args)...)
+            {
+            }
+        };
+
+        // Control byte states. Full slots store the low 7 bits of
+        // their hash (always >= 0), so any negative byte is free
+        inline constexpr int8_t __ctrl_empty = -128; // 0b10000000
+        inline constexpr int8_t __ctrl_deleted = -2; // 0b11111110
+
+        /**
+         * \brief Bitmask over the matching slots of a control group.
+         *
+         * \tparam T Underlying integer type of the mask.
+         * \tparam Shift log2 of the number of mask bits used per slot.
+         */
+        template <typename T, int Shift>
+        class __group_mask
+        {
+            T mask_;
+
+        public:
+            explicit __group_mask(const T mask) : mask_(mask) {}
+
+            explicit operator bool() const
+            {
+                return mask_ != 0;
+            }
+
+            /// Index (within the group) of the first matching slot
+            [[nodiscard]] size_t lowest() const
+            {
+                return static_cast<size_t>(count_trailing_zeros(mask_)) >> Shift;
+            }
+
+            void clear_lowest()
+            {
+                mask_ &= mask_ - 1;
+            }
+        };
+
+        /**
+         * \brief Portable group of 8 control bytes compared with SWAR arithmetic.
+         *
+         * Every query inspects the whole group at once; matches are reported
+         * through the high bit of each byte.
+         */
+        class __hash_group
+        {
+            static constexpr uint64_t lsbs = 0x0101010101010101ull;
+            static constexpr uint64_t msbs = 0x8080808080808080ull;
+            uint64_t ctrl_;
+
+        public:
+            static constexpr size_t width = 8;
+            using mask = __group_mask<uint64_t, 3>;
+
+            explicit __hash_group(const int8_t *ctrl)
+            {
+                memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+#           if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                ctrl_ = __builtin_bswap64(ctrl_); // Slot 0 must map to the lowest byte
+#           endif
+            }
+
+            /// Slots whose H2 equals the given fragment (may contain false positives on full slots)
+            [[nodiscard]] mask match(const int8_t h2) const
+            {
+                const uint64_t x = ctrl_ ^ (lsbs * static_cast<uint8_t>(h2));
+                return mask((x - lsbs) & ~x & msbs);
+            }
+
+            [[nodiscard]] mask match_empty() const
+            {
+                // Empty is the only state with the high bit set and bit 1 clear
+                return mask(ctrl_ & ~(ctrl_ << 6) & msbs);
+            }
+
+            [[nodiscard]] mask match_free() const
+            {
+                return mask(ctrl_ & msbs);
+            }
+        };
+
+#   ifdef ZELIX_STL_SSE2_AVAILABLE
+        /**
+         * \brief Group of 16 control bytes compared with a single SSE2 instruction.
+         */
+        class __hash_group_sse2
+        {
+            __m128i ctrl_;
+
+        public:
+            static constexpr size_t width = 16;
+            using mask = __group_mask<uint32_t, 0>;
+
+            explicit __hash_group_sse2(const int8_t *ctrl) :
+                ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl)))
+            {
+            }
+
+            [[nodiscard]] mask match(const int8_t h2) const
+            {
+                return mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+            }
+
+            [[nodiscard]] mask match_empty() const
+            {
+                return mask(static_cast<uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(__ctrl_empty), ctrl_))));
+            }
+
+            [[nodiscard]] mask match_free() const
+            {
+                // Free states are exactly the negative bytes
+                return mask(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+            }
+        };
+#   endif
+
+#   ifdef ZELIX_STL_AVX2_AVAILABLE
+        /**
+         * \brief Group of 32 control bytes compared with a single AVX2 instruction.
+         */
+        class __hash_group_avx2
+        {
+            __m256i ctrl_;
+
+        public:
+            static constexpr size_t width = 32;
+            using mask = __group_mask<uint32_t, 0>;
+
+            explicit __hash_group_avx2(const int8_t *ctrl) :
+                ctrl_(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ctrl)))
+            {
+            }
+
+            [[nodiscard]] mask match(const int8_t h2) const
+            {
+                return mask(static_cast<uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), ctrl_))));
+            }
+
+            [[nodiscard]] mask match_empty() const
+            {
+                return mask(static_cast<uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(__ctrl_empty), ctrl_))));
+            }
+
+            [[nodiscard]] mask match_free() const
+            {
+                return mask(static_cast<uint32_t>(_mm256_movemask_epi8(ctrl_)));
+            }
+        };
+#   endif
+
+        // Widest group the target can compare in one instruction
+#   if defined(ZELIX_STL_AVX2_AVAILABLE)
+        using __default_hash_group = __hash_group_avx2;
+#   elif defined(ZELIX_STL_SSE2_AVAILABLE)
+        using __default_hash_group = __hash_group_sse2;
+#   else
+        using __default_hash_group = __hash_group;
+#   endif
+
+        /**
+         * \brief Open-addressing hash map with SwissTable-style control bytes.
+         *
+         * Keys and values live in a single flat slot array, and a parallel array of
+         * one-byte control words (empty, deleted, or 7 bits of the hash) is probed
+         * a whole group at a time (8 bytes with SWAR, 16 with SSE2, 32 with AVX2
+         * when ZELIX_STL_USE_SIMD is on), so a lookup rarely touches more than one
+         * cache line of metadata and one slot.
+         *
+         * Heterogeneous lookup is enabled when both Hash and Equal declare
+         * `is_transparent` (e.g. string_hash and string_equal); external_string
+         * keys can then probe a string-keyed table without allocating.
+         *
+         * \tparam Key Type of the key.
+         * \tparam Value Type of the value.
+         * \tparam Hash Hash functor.
+         * \tparam Equal Equality functor.
+         * \tparam Allocator Allocator for the slot array.
+         * \tparam ControlAllocator Allocator for the control bytes.
+         */
+        template <
+            typename Key,
+            typename Value,
+            typename Hash = std::hash<Key>,
+            typename Equal = std::equal_to<Key>,
+            typename Allocator = memory::system_array_resource<__hash_slot<Key, Value>>,
+            typename ControlAllocator = memory::system_array_resource<int8_t>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<__hash_slot<Key, Value>>, Allocator>
+            >,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<int8_t>, ControlAllocator>
+            >
+        >
+        class hash_map
+        {
+        public:
+            using value_type = __hash_slot<Key, Value>;
+            using group = __default_hash_group;
+
+        private:
+            static constexpr size_t npos = static_cast<size_t>(-1);
+            static constexpr size_t min_capacity = group::width < 16 ? 16 : group::width;
+
+            template <typename K>
+            static constexpr bool transparent_v =
+                requires { typename Hash::is_transparent; typename Equal::is_transparent; } &&
+                !std::is_same_v<std::remove_cvref_t<K>, Key>;
+
+            int8_t *ctrl_ = nullptr; ///< Control bytes, followed by a clone of the first group
+            value_type *slots_ = nullptr; ///< Slot storage (only full slots are constructed)
+            size_t capacity_ = 0; ///< Number of slots, always a power of two (or zero)
+            size_t size_ = 0; ///< Number of live elements
+            size_t growth_left_ = 0; ///< Empty slots we may still fill before rehashing
+
+            [[nodiscard]] static size_t mix(const size_t hash)
+            {
+                // Spread weak hashes (e.g. identity hashes of integers)
+                // over all bits before splitting them into H1/H2
+                const uint64_t m = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+                return static_cast<size_t>(m ^ (m >> 32));
+            }
+
+            [[nodiscard]] static int8_t h2(const size_t hash)
+            {
+                return static_cast<int8_t>(hash & 0x7F);
+            }
+
+            [[nodiscard]] static size_t max_load(const size_t capacity)
+            {
+                return capacity - capacity / 8; // 7/8 load factor
+            }
+
+            void set_ctrl(const size_t i, const int8_t c)
+            {
+                ctrl_[i] = c;
+
+                // Keep the cloned bytes in sync so that groups starting
+                // near the end of the table can be loaded in one go
+                if (i < group::width)
+                {
+                    ctrl_[capacity_ + i] = c;
+                }
+            }
+
+            template <typename K>
+            [[nodiscard]] size_t find_index(const K &key, const size_t hash) const
+            {
+                if (capacity_ == 0) return npos;
+
+                const size_t mask = capacity_ - 1;
+                const int8_t fragment = h2(hash);
+                size_t pos = (hash >> 7) & mask;
+                size_t step = 0;
+
+                while (true)
+                {
+                    const group g(ctrl_ + pos);
+                    for (auto m = g.match(fragment); m; m.clear_lowest())
+                    {
+                        const size_t idx = (pos + m.lowest()) & mask;
+                        if (Equal{}(key, slots_[idx].key))
+                        {
+                            return idx;
+                        }
+                    }
+
+                    // A single empty slot proves the key was never pushed further
+                    if (g.match_empty())
+                    {
+                        return npos;
+                    }
+
+                    // Triangular probing visits every group when the capacity is a power of two
+                    step += group::width;
+                    pos = (pos + step) & mask;
+                }
+            }
+
+            [[nodiscard]] size_t find_free(const size_t hash) const
+            {
+                const size_t mask = capacity_ - 1;
+                size_t pos = (hash >> 7) & mask;
+                size_t step = 0;
+
+                while (true)
+                {
+                    const group g(ctrl_ + pos);
+                    if (const auto m = g.match_free())
+                    {
+                        return (pos + m.lowest()) & mask;
+                    }
+
+                    step += group::width;
+                    pos = (pos + step) & mask;
+                }
+            }
+
+            void allocate_table(const size_t capacity)
+            {
+                capacity_ = capacity;
+                ctrl_ = ControlAllocator::allocate(capacity + group::width);
+                slots_ = Allocator::allocate(capacity);
+
+                if (!ctrl_ || !slots_)
+                {
+                    throw except::failed_alloc("Memory allocation failed.");
+                }
+
+                memset(ctrl_, static_cast<uint8_t>(__ctrl_empty), capacity + group::width);
+                growth_left_ = max_load(capacity);
+            }
+
+            void rehash(const size_t new_capacity)
+            {
+                ZELIX_STL_PROBE1(hash_map_rehash, new_capacity);
+                int8_t *old_ctrl = ctrl_;
+                value_type *old_slots = slots_;
+                const size_t old_capacity = capacity_;
+
+                allocate_table(new_capacity);
+                for (size_t i = 0; i < old_capacity; ++i)
+                {
+                    if (old_ctrl[i] < 0) continue;
+
+                    value_type &slot = old_slots[i];
+                    const size_t hash = mix(Hash{}(slot.key));
+                    const size_t idx = find_free(hash);
+                    set_ctrl(idx, h2(hash));
+
+                    if constexpr (std::is_trivially_copyable_v<value_type>)
+                    {
+                        memcpy(static_cast<void *>(&slots_[idx]), &slot, sizeof(value_type));
+                    }
+                    else
+                    {
+                        new (&slots_[idx]) value_type(stl::move(slot));
+                        slot.~value_type();
+                    }
+                }
+
+                growth_left_ -= size_;
+                if (old_ctrl)
+                {
+                    ControlAllocator::deallocate(old_ctrl);
+                    Allocator::deallocate(old_slots);
+                }
+            }
+
+            /// Returns the index of a free slot for a new element with the given hash
+            size_t prepare_insert(const size_t hash)
+            {
+                size_t idx = capacity_ == 0 ? npos : find_free(hash);
+
+                // Tombstones can be reused without consuming growth
+                if (idx == npos || (growth_left_ == 0 && ctrl_[idx] != __ctrl_deleted))
+                {
+                    if (capacity_ == 0)
+                    {
+                        rehash(min_capacity);
+                    }
+                    else if (size_ <= max_load(capacity_) / 2)
+                    {
+                        rehash(capacity_); // Mostly tombstones, clean them up in place
+                    }
+                    else
+                    {
+                        rehash(capacity_ * 2);
+                    }
+
+                    idx = find_free(hash);
+                }
+
+                if (ctrl_[idx] == __ctrl_empty)
+                {
+                    --growth_left_;
+                }
+
+                set_ctrl(idx, h2(hash));
+                ++size_;
+                return idx;
+            }
+
+            template <typename K, typename... Args>
+            size_t unified_emplace(K &&key, Args&&... args)
+            {
+                if constexpr (!std::is_same_v<std::remove_cvref_t<K>, Key>)
+                {
+                    // Hash the key exactly as it will be stored
+                    return unified_emplace(Key(stl::forward<K>(key)), stl::forward<Args>(args)...);
+                }
+                else
+                {
+                    const size_t hash = mix(Hash{}(key));
+                    if (const size_t idx = find_index(key, hash); idx != npos)
+                    {
+                        return idx;
+                    }
+
+                    const size_t idx = prepare_insert(hash);
+                    new (&slots_[idx]) value_type(stl::forward<K>(key), stl::forward<Args>(args)...);
+                    return idx;
+                }
+            }
+
+            void destroy_slots()
+            {
+                if constexpr (!std::is_trivially_destructible_v<value_type>)
+                {
+                    for (size_t i = 0; i < capacity_; ++i)
+                    {
+                        if (ctrl_[i] >= 0)
+                        {
+                            slots_[i].~value_type();
+                        }
+                    }
+                }
+            }
+
+            void release()
+            {
+                if (!ctrl_) return;
+
+                destroy_slots();
+                ControlAllocator::deallocate(ctrl_);
+                Allocator::deallocate(slots_);
+                ctrl_ = nullptr;
+                slots_ = nullptr;
+                capacity_ = 0;
+                size_ = 0;
+                growth_left_ = 0;
+            }
+
+        public:
+            class iterator
+            {
+                const int8_t *ctrl_;
+                const int8_t *end_;
+                value_type *slot_;
+
+                void skip_free()
+                {
+                    while (ctrl_ != end_ && *ctrl_ < 0)
+                    {
+                        ++ctrl_;
+                        ++slot_;
+                    }
+                }
+
+            public:
+                iterator(const int8_t *ctrl, const int8_t *end, value_type *slot) :
+                    ctrl_(ctrl), end_(end), slot_(slot)
+                {
+                    skip_free();
+                }
+
+                value_type &operator*() const
+                {
+                    return *slot_;
+                }
+
+                value_type *operator->() const
+                {
+                    return slot_;
+                }
+
+                iterator &operator++()
+                {
+                    ++ctrl_;
+                    ++slot_;
+                    skip_free();
+                    return *this;
+                }
+
+                iterator operator++(int)
+                {
+                    iterator tmp = *this;
+                    ++(*this);
+                    return tmp;
+                }
+
+                bool operator==(const iterator &other) const { return ctrl_ == other.ctrl_; }
+                bool operator!=(const iterator &other) const { return ctrl_ != other.ctrl_; }
+            };
+
+            hash_map() = default;
+
+            hash_map(const hash_map &) = delete;
+            hash_map &operator=(const hash_map &) = delete;
+
+            hash_map(hash_map &&other) noexcept :
+                ctrl_(other.ctrl_), slots_(other.slots_), capacity_(other.capacity_), size_(other.size_),
+                growth_left_(other.growth_left_)
+            {
+                other.ctrl_ = nullptr;
+                other.slots_ = nullptr;
+                other.capacity_ = 0;
+                other.size_ = 0;
+                other.growth_left_ = 0;
+            }
+
+            hash_map &operator=(hash_map &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    ctrl_ = other.ctrl_;
+                    slots_ = other.slots_;
+                    capacity_ = other.capacity_;
+                    size_ = other.size_;
+                    growth_left_ = other.growth_left_;
+
+                    other.ctrl_ = nullptr;
+                    other.slots_ = nullptr;
+                    other.capacity_ = 0;
+                    other.size_ = 0;
+                    other.growth_left_ = 0;
+                }
+
+                return *this;
+            }
+
+            /**
+             * \brief Inserts a key-value pair into the map (duplicates are ignored).
+             * \param key The key to insert.
+             * \param value The value to associate with the key.
+             * \return True if the key was inserted, false if it already existed.
+             */
+            template <typename K = Key, typename V = Value>
+            bool insert(K &&key, V &&value)
+            {
+                const size_t old_size = size_;
+                unified_emplace(stl::forward<K>(key), stl::forward<V>(value));
+                return size_ != old_size;
+            }
+
+            /**
+             * \brief Constructs a value in-place unless the key already exists.
+             * \param key The key to insert.
+             * \param args Arguments forwarded to the value's constructor.
+             * \return Iterator to the new element, or to the existing one.
+             */
+            template <typename K = Key, typename... Args>
+            iterator emplace(K &&key, Args&&... args)
+            {
+                const size_t idx = unified_emplace(stl::forward<K>(key), stl::forward<Args>(args)...);
+                return iterator(ctrl_ + idx, ctrl_ + capacity_, slots_ + idx);
+            }
+
+            /**
+             * \brief Removes a key (and its value) from the map.
+             * \param key The key to remove.
+             * \return True if the key was found and removed, false otherwise.
+             */
+            bool erase(const Key &key)
+            {
+                return unified_erase(key);
+            }
+
+            template <typename K, typename = std::enable_if_t<transparent_v<K>>>
+            bool erase(const K &key)
+            {
+                return unified_erase(key);
+            }
+
+            /**
+             * \brief Checks if the map contains a given key.
+             * \param key The key to check.
+             * \return True if the key exists, false otherwise.
+             */
+            [[nodiscard]] bool contains(const Key &key) const
+            {
+                return find_index(key, mix(Hash{}(key))) != npos;
+            }
+
+            template <typename K, typename = std::enable_if_t<transparent_v<K>>>
+            [[nodiscard]] bool contains(const K &key) const
+            {
+                return find_index(key, mix(Hash{}(key))) != npos;
+            }
+
+            /**
+             * \brief Finds the element associated with a key.
+             * \param key The key to look up.
+             * \return Iterator to the element, or end() if the key does not exist.
+             */
+            iterator find(const Key &key)
+            {
+                return iterator_at(find_index(key, mix(Hash{}(key))));
+            }
+
+            template <typename K, typename = std::enable_if_t<transparent_v<K>>>
+            iterator find(const K &key)
+            {
+                return iterator_at(find_index(key, mix(Hash{}(key))));
+            }
+
+            /**
+             * \brief Gets the value associated with a key without throwing.
+             * \param key The key to look up.
+             * \return Pointer to the value, or nullptr if the key does not exist.
+             */
+            Value *try_get(const Key &key)
+            {
+                const size_t idx = find_index(key, mix(Hash{}(key)));
+                return idx == npos ? nullptr : &slots_[idx].value;
+            }
+
+            template <typename K, typename = std::enable_if_t<transparent_v<K>>>
+            Value *try_get(const K &key)
+            {
+                const size_t idx = find_index(key, mix(Hash{}(key)));
+                return idx == npos ? nullptr : &slots_[idx].value;
+            }
+
+            /**
+             * \brief Gets the value associated with a key.
+             * \param key The key to look up.
+             * \return Reference to the value associated with the key.
+             * \throws except::element_not_found if the key does not exist.
+             */
+            Value &get(const Key &key)
+            {
+                return unified_get(key);
+            }
+
+            template <typename K, typename = std::enable_if_t<transparent_v<K>>>
+            Value &get(const K &key)
+            {
+                return unified_get(key);
+            }
+
+            /**
+             * \brief Accesses the value associated with a key (operator[]).
+             * \param key The key to look up.
+             * \return Reference to the value associated with the key.
+             */
+            Value &operator[](const Key &key)
+            {
+                return get(key);
+            }
+
+            /**
+             * \brief Reserves room for at least n elements without rehashing.
+             * \param n The number of elements to make room for.
+             */
+            void reserve(const size_t n)
+            {
+                size_t capacity = min_capacity;
+                while (max_load(capacity) < n)
+                {
+                    capacity *= 2;
+                }
+
+                if (capacity > capacity_)
+                {
+                    rehash(capacity);
+                }
+            }
+
+            /**
+             * \brief Removes all elements, keeping the allocated table.
+             */
+            void clear()
+            {
+                if (!ctrl_) return;
+
+                destroy_slots();
+                memset(ctrl_, static_cast<uint8_t>(__ctrl_empty), capacity_ + group::width);
+                size_ = 0;
+                growth_left_ = max_load(capacity_);
+            }
+
+            iterator begin()
+            {
+                return iterator(ctrl_, ctrl_ + capacity_, slots_);
+            }
+
+            iterator end()
+            {
+                return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_);
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return size_;
+            }
+
+            [[nodiscard]] size_t capacity() const
+            {
+                return capacity_;
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return size_ == 0;
+            }
+
+            ~hash_map()
+            {
+                release();
+            }
+
+        private:
+            iterator iterator_at(const size_t idx)
+            {
+                if (idx == npos) return end();
+                return iterator(ctrl_ + idx, ctrl_ + capacity_, slots_ + idx);
+            }
+
+            template <typename K>
+            Value &unified_get(const K &key)
+            {
+                const size_t idx = find_index(key, mix(Hash{}(key)));
+                if (idx == npos)
+                {
+                    throw except::element_not_found();
+                }
+
+                return slots_[idx].value;
+            }
+
+            template <typename K>
+            bool unified_erase(const K &key)
+            {
+                const size_t idx = find_index(key, mix(Hash{}(key)));
+                if (idx == npos) return false;
+
+                slots_[idx].~value_type();
+                set_ctrl(idx, __ctrl_deleted);
+                --size_;
+                return true;
+            }
+        };
+    } // namespace pmr
+
+    template <
+        typename Key,
+        typename Value,
+        typename Hash = std::hash<Key>,
+        typename Equal = std::equal_to<Key>
+    >
+    using hash_map = pmr::hash_map<Key, Value, Hash, Equal>;
+
+    template <typename Value>
+    using string_map = pmr::hash_map<string, Value, string_hash, string_equal>; ///< String-keyed map with heterogeneous external_string lookup
+} // namespace zelix::stl
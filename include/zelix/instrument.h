@@ -0,0 +1,318 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+#include "zelix/cache_aligned.h"
+
+#if defined(ZELIX_STL_TIMER_RDTSC) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64))
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <x86intrin.h>
+#   endif
+#   define ZELIX_STL_RDTSC_TIMER
+#endif
+
+namespace zelix::stl::instrument
+{
+    /// Unit of scoped_timer readings
+#   ifdef ZELIX_STL_RDTSC_TIMER
+    inline constexpr const char *time_unit = "cycles";
+#   else
+    inline constexpr const char *time_unit = "ns";
+#   endif
+
+    /**
+     * \brief Current time for scoped_timer.
+     *
+     * The time stamp counter with ZELIX_STL_TIMER_RDTSC on x86 (cheapest,
+     * but in cycles and not ordered against surrounding loads), otherwise
+     * CLOCK_MONOTONIC in nanoseconds.
+     */
+    inline uint64_t now()
+    {
+#   if defined(ZELIX_STL_RDTSC_TIMER)
+        return __rdtsc();
+#   elif defined(CLOCK_MONOTONIC)
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#   else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+#   endif
+    }
+
+    /// Something dump() can print, linked into one registry per kind
+    template <typename Derived>
+    class __registered
+    {
+        inline static std::atomic<Derived *> head_{nullptr};
+
+        const char *name_;
+        Derived *next_ = nullptr;
+
+    protected:
+        explicit __registered(const char *name) : name_(name)
+        {
+            next_ = head_.load(std::memory_order_relaxed);
+            while (!head_.compare_exchange_weak(next_, static_cast<Derived *>(this), std::memory_order_release, std::memory_order_relaxed)) {}
+        }
+
+    public:
+        __registered(const __registered &) = delete;
+        __registered &operator=(const __registered &) = delete;
+
+        [[nodiscard]] const char *name() const
+        {
+            return name_;
+        }
+
+        [[nodiscard]] Derived *next() const
+        {
+            return next_;
+        }
+
+        static Derived *first()
+        {
+            return head_.load(std::memory_order_acquire);
+        }
+    };
+
+    inline constexpr size_t __counter_shards = 16;
+    inline std::atomic<size_t> __next_shard{0};
+
+    /// Shard of the calling thread, threads are spread round-robin
+    inline size_t __thread_shard()
+    {
+        static thread_local const size_t shard = __next_shard.fetch_add(1, std::memory_order_relaxed) % __counter_shards;
+        return shard;
+    }
+
+    /**
+     * \brief Hit count and running total, sharded over cache lines.
+     *
+     * Each thread bumps its own shard with relaxed atomics so hot probes
+     * hitting from many threads do not bounce one line around; reads add
+     * the shards up. Counters sharing a name are reported together.
+     */
+    class counter : public __registered<counter>
+    {
+        struct shard
+        {
+            std::atomic<uint64_t> hits{0};
+            std::atomic<uint64_t> total{0};
+        };
+
+        cache_aligned<shard> shards_[__counter_shards];
+
+    public:
+        explicit counter(const char *name) : __registered(name) {}
+
+        void add(const uint64_t value = 1)
+        {
+            shard &s = *shards_[__thread_shard()];
+            s.hits.fetch_add(1, std::memory_order_relaxed);
+            s.total.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] uint64_t hits() const
+        {
+            uint64_t n = 0;
+            for (const auto &s : shards_) n += s->hits.load(std::memory_order_relaxed);
+            return n;
+        }
+
+        [[nodiscard]] uint64_t total() const
+        {
+            uint64_t n = 0;
+            for (const auto &s : shards_) n += s->total.load(std::memory_order_relaxed);
+            return n;
+        }
+    };
+
+    /**
+     * \brief Distribution of durations in power-of-two buckets.
+     *
+     * Bucket i holds values in [2^(i-1), 2^i), bucket 0 holds zero.
+     * Quantiles are reported as the upper bound of their bucket.
+     */
+    class histogram : public __registered<histogram>
+    {
+    public:
+        static constexpr size_t buckets = 65;
+
+    private:
+        std::atomic<uint64_t> counts_[buckets] = {};
+        std::atomic<uint64_t> total_{0};
+        std::atomic<uint64_t> max_{0};
+
+    public:
+        explicit histogram(const char *name) : __registered(name) {}
+
+        void record(const uint64_t value)
+        {
+            const size_t bucket = value == 0 ? 0 : 64 - static_cast<size_t>(__builtin_clzll(value));
+            counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+            total_.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t seen = max_.load(std::memory_order_relaxed);
+            while (value > seen && !max_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+        }
+
+        [[nodiscard]] uint64_t count() const
+        {
+            uint64_t n = 0;
+            for (const auto &c : counts_) n += c.load(std::memory_order_relaxed);
+            return n;
+        }
+
+        [[nodiscard]] uint64_t total() const
+        {
+            return total_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] uint64_t max() const
+        {
+            return max_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] uint64_t bucket(const size_t i) const
+        {
+            return counts_[i].load(std::memory_order_relaxed);
+        }
+
+        /// Upper bound of the bucket holding the q-th quantile, q in [0, 1]
+        [[nodiscard]] uint64_t quantile(const double q) const
+        {
+            const uint64_t n = count();
+            if (n == 0) return 0;
+
+            const auto rank = static_cast<uint64_t>(q * static_cast<double>(n - 1)) + 1;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < buckets; ++i)
+            {
+                seen += bucket(i);
+                if (seen >= rank) return i == 0 ? 0 : (i == 64 ? ~uint64_t(0) : (uint64_t(1) << i) - 1);
+            }
+
+            return max();
+        }
+    };
+
+    /// Records the time from construction to destruction into a histogram
+    class scoped_timer
+    {
+        histogram &histogram_;
+        uint64_t start_;
+
+    public:
+        explicit scoped_timer(histogram &h) : histogram_(h), start_(now()) {}
+
+        scoped_timer(const scoped_timer &) = delete;
+        scoped_timer &operator=(const scoped_timer &) = delete;
+
+        ~scoped_timer()
+        {
+            histogram_.record(now() - start_);
+        }
+    };
+
+    template <typename Stream>
+    void __write(Stream &out, const char *text)
+    {
+        out.write(text, strlen(text));
+    }
+
+    /**
+     * \brief Writes every counter and histogram to any stream with write() and operator<<.
+     *
+     * Counters of the same name (one per call site or template instance)
+     * are merged into one line. Nothing is printed before the first probe
+     * fires, so with instrumentation disabled the dump is empty.
+     */
+    template <typename Stream>
+    void dump(Stream &out)
+    {
+        for (const counter *c = counter::first(); c; c = c->next())
+        {
+            // Only the first counter of each name prints, with the others folded in
+            bool seen = false;
+            for (const counter *p = counter::first(); p != c; p = p->next())
+            {
+                if (strcmp(p->name(), c->name()) == 0) seen = true;
+            }
+            if (seen) continue;
+
+            uint64_t hits = 0, total = 0;
+            for (const counter *same = c; same; same = same->next())
+            {
+                if (strcmp(same->name(), c->name()) != 0) continue;
+                hits += same->hits();
+                total += same->total();
+            }
+
+            __write(out, "counter ");
+            __write(out, c->name());
+            __write(out, ": hits=");
+            out << static_cast<unsigned long long>(hits);
+            __write(out, " total=");
+            out << static_cast<unsigned long long>(total);
+            __write(out, "\n");
+        }
+
+        for (const histogram *h = histogram::first(); h; h = h->next())
+        {
+            const uint64_t n = h->count();
+            __write(out, "timer ");
+            __write(out, h->name());
+            __write(out, " (");
+            __write(out, time_unit);
+            __write(out, "): count=");
+            out << static_cast<unsigned long long>(n);
+            __write(out, " mean=");
+            out << static_cast<unsigned long long>(n ? h->total() / n : 0);
+            __write(out, " p50<=");
+            out << static_cast<unsigned long long>(h->quantile(0.5));
+            __write(out, " p99<=");
+            out << static_cast<unsigned long long>(h->quantile(0.99));
+            __write(out, " max=");
+            out << static_cast<unsigned long long>(h->max());
+            __write(out, "\n");
+        }
+    }
+}
@@ -0,0 +1,224 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/8/25.
+//
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <xxh3.h>
+
+#include "external_string.h"
+#include "hash_map.h"
+#include "owned_string.h"
+#include "vector.h"
+#include "memory/arena.h"
+
+namespace zelix::stl
+{
+    /**
+     * \brief Deduplicates strings into stable, arena-backed storage.
+     *
+     * Every distinct string is copied once into the pool's arena (null-terminated)
+     * and handed out as an external_string view or a 32-bit symbol ID. Two handles
+     * from the same pool are equal exactly when their IDs (or pointers) are, so
+     * comparisons never touch the characters. ID 0 is reserved for the empty string.
+     * Handles stay valid for the lifetime of the pool.
+     */
+    class intern_pool
+    {
+        memory::arena arena_;
+        hash_map<external_string, uint32_t, external_string_hash> ids_;
+        vector<external_string> views_;
+
+    public:
+        intern_pool()
+        {
+            views_.push_back(external_string()); // ID 0 -> empty string
+        }
+
+        intern_pool(const intern_pool &) = delete;
+        intern_pool &operator=(const intern_pool &) = delete;
+
+        /**
+         * \brief Interns a string and returns its symbol ID.
+         * \param str Pointer to the characters.
+         * \param len Number of characters.
+         * \return The ID shared by every equal string, 0 for the empty string.
+         */
+        uint32_t intern_id(const char *str, const size_t len)
+        {
+            if (len == 0) return 0;
+
+            if (const uint32_t *id = ids_.try_get(external_string(str, len)))
+            {
+                return *id;
+            }
+
+            auto copy = static_cast<char *>(arena_.allocate(len + 1, 1));
+            memcpy(copy, str, len);
+            copy[len] = '\0';
+
+            const auto id = static_cast<uint32_t>(views_.size());
+            const external_string view(copy, len);
+            views_.push_back(view);
+            ids_.insert(view, id);
+            return id;
+        }
+
+        uint32_t intern_id(const char *str)
+        {
+            return intern_id(str, str::len(str));
+        }
+
+        uint32_t intern_id(const string &str)
+        {
+            return intern_id(str.ptr(), str.size());
+        }
+
+        uint32_t intern_id(const external_string &str)
+        {
+            return intern_id(str.ptr(), str.size());
+        }
+
+        /**
+         * \brief Interns a string and returns a view of the pooled copy.
+         * \return A stable view, pointer-equal for equal strings.
+         */
+        template <typename S>
+        external_string intern(const S &str)
+        {
+            return view(intern_id(str));
+        }
+
+        external_string intern(const char *str, const size_t len)
+        {
+            return view(intern_id(str, len));
+        }
+
+        /**
+         * \brief Returns the interned string for a symbol ID.
+         * \param id An ID previously returned by this pool.
+         */
+        [[nodiscard]] external_string view(const uint32_t id) const
+        {
+            return views_[id];
+        }
+
+        /**
+         * \brief Number of distinct non-empty strings in the pool.
+         */
+        [[nodiscard]] size_t size() const
+        {
+            return views_.size() - 1;
+        }
+    };
+
+    /**
+     * \brief Thread-safe intern pool split into independently locked shards.
+     *
+     * Strings are routed to a shard by hash, so threads interning different
+     * strings rarely contend. The low bits of an ID name its shard.
+     *
+     * \tparam ShardBits Log2 of the number of shards, from 1 to 31.
+     */
+    template <size_t ShardBits = 4>
+    class concurrent_intern_pool
+    {
+        // The shard index takes the top ShardBits of the hash and the low bits of each id
+        static_assert(ShardBits > 0 && ShardBits < 32, "ShardBits must be between 1 and 31");
+        static constexpr size_t shard_count = size_t(1) << ShardBits;
+
+        struct alignas(64) shard
+        {
+            std::mutex mutex;
+            intern_pool pool;
+        };
+
+        shard shards_[shard_count];
+
+    public:
+        uint32_t intern_id(const char *str, const size_t len)
+        {
+            if (len == 0) return 0;
+
+            const size_t index = XXH3_64bits(str, len) >> (64 - ShardBits);
+            shard &s = shards_[index];
+
+            std::unique_lock lock(s.mutex);
+            return s.pool.intern_id(str, len) << ShardBits | static_cast<uint32_t>(index);
+        }
+
+        uint32_t intern_id(const char *str)
+        {
+            return intern_id(str, str::len(str));
+        }
+
+        uint32_t intern_id(const string &str)
+        {
+            return intern_id(str.ptr(), str.size());
+        }
+
+        uint32_t intern_id(const external_string &str)
+        {
+            return intern_id(str.ptr(), str.size());
+        }
+
+        template <typename S>
+        external_string intern(const S &str)
+        {
+            return view(intern_id(str));
+        }
+
+        external_string intern(const char *str, const size_t len)
+        {
+            return view(intern_id(str, len));
+        }
+
+        [[nodiscard]] external_string view(const uint32_t id)
+        {
+            if (id == 0) return {};
+
+            shard &s = shards_[id & (shard_count - 1)];
+            std::unique_lock lock(s.mutex);
+            return s.pool.view(id >> ShardBits);
+        }
+
+        [[nodiscard]] size_t size()
+        {
+            size_t total = 0;
+            for (auto &s : shards_)
+            {
+                std::unique_lock lock(s.mutex);
+                total += s.pool.size();
+            }
+
+            return total;
+        }
+    };
+}
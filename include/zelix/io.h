@@ -29,25 +29,41 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
 #include <iostream>
+#include <thread>
 
 
 #include "display.h"
+#include "external_string.h"
+#include "optional.h"
+#include "probe.h"
 #include "owned_string.h"
+#include "ring_buffer.h"
+#include "string_utils.h"
+#include "zelix/algorithm/ftoi.h"
+#include "zelix/except/io_error.h"
 #if !defined(_WIN32) && defined(__has_include) && __has_include(<unistd.h>)
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <sys/uio.h>
 #   include <unistd.h>
 #   define ZELIX_STL_FULL_IO_SUPPORT
 #else
 #   if defined(__has_include) && __has_include(<windows.h>)
 #       define ZELIX_STL_FULL_IO_SUPPORT
+#       include <fcntl.h>
+#       include <io.h>
+#       include <sys/stat.h>
 #       include <windows.h>
 #   endif
 #endif
 
 #ifdef ZELIX_STL_FULL_IO_SUPPORT
-#   include "ring_buffer.h"
-#   include "zelix/algorithm/ftoi.h"
 #   include "zelix/algorithm/itoa.h"
+#   include <cerrno>
+#   include <condition_variable>
 #   include <mutex>
 #else
 #   include <iostream> // Fallback to standard library for Windows
@@ -68,6 +84,346 @@ namespace zelix::stl
     inline constexpr auto STDERR_FILENO = 2;
 #endif
 
+#ifndef STDIN_FILENO
+    inline constexpr auto STDIN_FILENO = 0;
+#endif
+
+#   ifdef ZELIX_STL_FULL_IO_SUPPORT
+    /**
+     * @brief Writes all of data to fd, retrying short writes and EINTR.
+     * @return false if the write failed.
+     */
+    static inline bool __write_fully(const int fd, const char *data, size_t size)
+    {
+#       ifdef _WIN32
+        const HANDLE handle = fd == STDOUT_FILENO ? stdout_handle
+            : fd == STDERR_FILENO ? stderr_handle
+            : reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+        while (size != 0)
+        {
+            DWORD written = 0;
+            const DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+            if (!WriteFile(handle, data, chunk, &written, nullptr))
+            {
+                return false;
+            }
+
+            data += written;
+            size -= written;
+        }
+#       else
+        while (size != 0)
+        {
+            const ssize_t written = ::write(fd, data, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return false;
+            }
+
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+#       endif
+
+        return true;
+    }
+
+    /**
+     * @brief Writes head followed by tail in as few syscalls as possible.
+     *
+     * Gathers both with writev on POSIX so a buffered prefix and a large
+     * payload go out together; falls back to two writes elsewhere.
+     */
+    static inline bool __write_fully(
+        const int fd,
+        const char *head, const size_t head_size,
+        const char *tail, const size_t tail_size
+    )
+    {
+#       ifdef _WIN32
+        return __write_fully(fd, head, head_size) && __write_fully(fd, tail, tail_size);
+#       else
+        iovec iov[2] = {
+            {const_cast<char *>(head), head_size},
+            {const_cast<char *>(tail), tail_size}
+        };
+
+        iovec *cur = head_size == 0 ? iov + 1 : iov;
+        int count = head_size == 0 ? 1 : 2;
+        while (count > 0)
+        {
+            const ssize_t written = ::writev(fd, cur, count);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return false;
+            }
+
+            // Skip what was fully written and resume inside a partial one
+            auto done = static_cast<size_t>(written);
+            while (count > 0 && done >= cur->iov_len)
+            {
+                done -= cur->iov_len;
+                ++cur;
+                --count;
+            }
+
+            if (count > 0)
+            {
+                cur->iov_base = static_cast<char *>(cur->iov_base) + done;
+                cur->iov_len -= done;
+            }
+        }
+
+        return true;
+#       endif
+    }
+
+    /// Writes out and empties buffer
+    template <typename Buffer>
+    static inline void __flush_buffer(const int fd, Buffer &buffer)
+    {
+        if (buffer.pos() == 0)
+        {
+            return;
+        }
+
+        ZELIX_STL_PROBE1(ostream_flush, buffer.pos());
+        __write_fully(fd, buffer.ptr(), buffer.pos());
+        buffer.flush(); // Clear the buffer after writing
+    }
+
+    /**
+     * @brief Appends data to a Capacity-sized buffer bound to fd.
+     *
+     * Payloads of at least Capacity bytes skip the copy and go out together
+     * with the buffered prefix; smaller ones top up the buffer and flush once.
+     */
+    template <size_t Capacity, typename Buffer>
+    static inline void __write_buffered(const int fd, Buffer &buffer, const char *data, const size_t size)
+    {
+        if (size <= Capacity - buffer.pos())
+        {
+            buffer.template write<false>(data, size);
+            if (buffer.full())
+            {
+                __flush_buffer(fd, buffer);
+            }
+
+            return;
+        }
+
+        if (size >= Capacity)
+        {
+            // Too big to be worth copying, send the buffered prefix and
+            // the payload together
+            __write_fully(fd, buffer.ptr(), buffer.pos(), data, size);
+            buffer.flush();
+            return;
+        }
+
+        // Top up the buffer, flush it and keep the rest buffered
+        const size_t space = Capacity - buffer.pos();
+        buffer.template write<false>(data, space);
+        __flush_buffer(fd, buffer);
+        buffer.template write<false>(data + space, size - space);
+    }
+
+    /**
+     * @brief Returns room for n contiguous bytes in a Capacity-sized buffer,
+     * calling flush first if needed, or nullptr if it cannot hold n bytes.
+     */
+    template <size_t Capacity, typename Buffer, typename Flush>
+    static inline char *__reserve_buffered(Buffer &buffer, const size_t n, Flush &&flush)
+    {
+        if (n > Capacity - buffer.pos())
+        {
+            flush();
+            if (n > Capacity - buffer.pos())
+            {
+                return nullptr;
+            }
+        }
+
+        return buffer.ptr() + buffer.pos();
+    }
+
+    /// Publishes n bytes written into the space returned by __reserve_buffered
+    template <typename Buffer, typename Flush>
+    static inline void __commit_buffered(Buffer &buffer, const size_t n, Flush &&flush)
+    {
+        buffer.commit(n);
+        if (buffer.full())
+        {
+            flush();
+        }
+    }
+#   endif
+
+    /**
+     * \brief Formatting overloads shared by every output stream.
+     *
+     * Formats each value into a stack buffer and hands the bytes to
+     * Derived::do_write, so streams only need to decide where the bytes go.
+     */
+    template <typename Derived>
+    class __output_base
+    {
+        Derived &self()
+        {
+            return *static_cast<Derived *>(this);
+        }
+
+        template <typename T>
+        Derived &write_numeric(const T val)
+        {
+            if constexpr (std::is_same_v<T, double>)
+            {
+                // Shortest representation that reads back as the same value
+                char f_buffer[algorithm::max_shortest_chars];
+                self().do_write(f_buffer, algorithm::dtoa(f_buffer, val));
+            }
+            else if constexpr (std::is_same_v<T, float>)
+            {
+                char f_buffer[algorithm::max_shortest_chars];
+                self().do_write(f_buffer, algorithm::ftoa(f_buffer, val));
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                char i_buffer[algorithm::max_integer_chars];
+                self().do_write(i_buffer, algorithm::itoa(val, i_buffer));
+            }
+            else
+            {
+                static_assert(
+                    false,
+                    "Unsupported type for ostream::write_numeric"
+                );
+            }
+
+            return self();
+        }
+
+    public:
+        /// Writes size raw bytes
+        Derived &write(const char *data, const size_t size)
+        {
+            self().do_write(data, size);
+            return self();
+        }
+
+        template <class T = string>
+        Derived &operator<<(T &&handle)
+        {
+            return write(handle.ptr(), handle.size());
+        }
+
+        Derived &operator<<(const bool val)
+        {
+            if (val)
+            {
+                return write("true", 4);
+            }
+
+            return write("false", 5);
+        }
+
+        template <
+            class T = display,
+            typename = std::enable_if_t<
+               std::is_base_of_v<T, display>
+            >
+        >
+        Derived &operator<<(T &&d)
+        {
+            auto val = d.serialize();
+            return write(val.c_str(), val.size());
+        }
+
+        Derived &operator<<(const short val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const int val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const long val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const long long val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const unsigned short val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const unsigned int val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const unsigned long val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const unsigned long long val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const float val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const double val)
+        {
+            return write_numeric(val);
+        }
+
+        Derived &operator<<(const algorithm::fixed f)
+        {
+            char f_buffer[algorithm::max_fixed_chars];
+            return write(f_buffer, algorithm::dtoi(f_buffer, f.value, f.decimals));
+        }
+
+        Derived &operator<<(const char *s)
+        {
+            return write(s, str::len(s));
+        }
+
+        Derived &operator<<(const char s)
+        {
+            return write(&s, 1);
+        }
+    };
+
+    /// How file_ostream opens its file
+    struct file_options
+    {
+        bool append = false; ///< Append instead of truncating
+        bool direct = false; ///< Bypass the page cache with O_DIRECT where supported
+        size_t preallocate = 0; ///< Bytes to reserve on disk up front, a hint
+    };
+
     namespace pmr
     {
         template <
@@ -79,252 +435,672 @@ namespace zelix::stl
                 std::is_base_of_v<memory::array_resource<char>, Allocator>
             >
         >
-        class ostream
+        class ostream : public __output_base<ostream<FileDescriptor, Capacity, UseHeap, Allocator>>
         {
+            friend class __output_base<ostream>;
+
 #           ifdef ZELIX_STL_FULL_IO_SUPPORT
             ring_buffer<char, Capacity, UseHeap, Allocator> buffer; ///< Ring buffer to hold the output data
 #           endif
             void do_write(const char *data, const size_t size)
             {
 #           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                // Write data to the file descriptor
-                if (size > Capacity)
-                {
-                    size_t remaining = size;
-                    auto ptr = const_cast<char *>(data);
-
-                    // Write in chunks
-                    while (remaining > Capacity)
-                    {
-                        // Write only what fits
-                        size_t space = Capacity - buffer.pos();
-                        buffer.template write<false>(ptr, space);
-                        ptr += space;
-                        remaining -= space;
-
-                        // Check if the buffer is full
-                        if (buffer.full())
-                        {
-                            flush();
-                        }
-                    }
-
-                    return;
-                }
-
-                buffer.template write<false>(data, size);
-                if (buffer.full())
-                {
-                    flush();
-                }
+                __write_buffered<Capacity>(FileDescriptor, buffer, data, size);
 #           else
-                std::cout << data; ///< Use standard output
+                std::cout.write(data, static_cast<std::streamsize>(size)); ///< Use standard output
 #           endif
             }
 
-            template <typename T>
-            void do_write_integral(T val)
-            {
+        public:
+            ostream()
 #           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
-                {
-                    // Convert floating point numbers to string
-                    char f_buffer[64] = {};
-                    do_write(f_buffer, algorithm::dtoi(f_buffer, static_cast<double>(val), 2));
-                }
-                else if constexpr (std::is_integral_v<T>) {
-                    char i_buffer[32] = {};
-                    const size_t len = algorithm::itoa(val, i_buffer);
-                    do_write(i_buffer, len);
-                }
-                else
+                : buffer()
+#           endif
+            {
+                if constexpr (FileDescriptor != STDERR_FILENO && FileDescriptor != STDOUT_FILENO)
                 {
                     static_assert(
                         false,
-                        "Unsupported type for ostream::do_write_integral"
+                        "Unsupported type for ostream, use STDOUT_FILENO or STDERR_FILENO"
                     );
                 }
+            }
+
+            void flush()
+            {
+#           ifdef ZELIX_STL_FULL_IO_SUPPORT
+                __flush_buffer(FileDescriptor, buffer);
 #           else
-                std::cout << val;
+                std::cout.flush(); // Use standard output flush for Windows
 #           endif
             }
 
-        public:
-            ostream()
 #           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                : buffer()
+            /**
+             * @brief Returns room for n contiguous bytes in the buffer, flushing
+             * first if needed, or nullptr if it cannot hold n bytes.
+             *
+             * Bytes written there become output once passed to commit().
+             */
+            char *reserve(const size_t n)
+            {
+                return __reserve_buffered<Capacity>(buffer, n, [this] { flush(); });
+            }
+
+            /// Publishes n bytes written into the space returned by reserve()
+            void commit(const size_t n)
+            {
+                __commit_buffered(buffer, n, [this] { flush(); });
+            }
 #           endif
+
+            ~ostream()
             {
-                if constexpr (FileDescriptor != STDERR_FILENO && FileDescriptor != STDOUT_FILENO)
+                flush();
+            }
+        };
+
+#       ifdef ZELIX_STL_FULL_IO_SUPPORT
+        /**
+         * \brief An ostream whose flushes happen on a background thread.
+         *
+         * Output goes into one of two Capacity-sized buffers. When it fills,
+         * the buffers swap and a flusher thread writes the full one while the
+         * caller keeps formatting into the other, so << only waits when the
+         * descriptor is slower than a whole buffer. Like ostream, a single
+         * instance must not be written by several threads at once.
+         */
+        template <
+            int FileDescriptor,
+            size_t Capacity,
+            bool UseHeap = Capacity >= 256,
+            typename Allocator = memory::system_array_resource<char>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<char>, Allocator>
+            >
+        >
+        class async_ostream : public __output_base<async_ostream<FileDescriptor, Capacity, UseHeap, Allocator>>
+        {
+            friend class __output_base<async_ostream>;
+            using buffer_type = ring_buffer<char, Capacity, UseHeap, Allocator>;
+
+            buffer_type buffers_[2];
+            buffer_type *front_ = &buffers_[0]; ///< Buffer being written by the caller
+            buffer_type *back_ = nullptr; ///< Buffer owned by the flusher, nullptr when idle
+            bool stop_ = false;
+            std::mutex mutex_;
+            std::condition_variable cv_;
+            std::thread flusher_;
+
+            void run()
+            {
+                std::unique_lock lock(mutex_);
+                while (true)
                 {
-                    static_assert(
-                        false,
-                        "Unsupported type for ostream, use STDOUT_FILENO or STDERR_FILENO"
-                    );
+                    cv_.wait(lock, [this] { return back_ != nullptr || stop_; });
+                    if (!back_)
+                    {
+                        return;
+                    }
+
+                    buffer_type *buf = back_;
+                    lock.unlock();
+                    __write_fully(FileDescriptor, buf->ptr(), buf->pos());
+                    buf->flush();
+                    lock.lock();
+
+                    back_ = nullptr;
+                    cv_.notify_all();
+                }
+            }
+
+            /// Hands the front buffer to the flusher, waiting while it is still busy
+            void hand_off()
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [this] { return back_ == nullptr; });
+                back_ = front_;
+                front_ = front_ == &buffers_[0] ? &buffers_[1] : &buffers_[0];
+                cv_.notify_all();
+            }
+
+            void do_write(const char *data, size_t size)
+            {
+                while (size > Capacity - front_->pos())
+                {
+                    const size_t space = Capacity - front_->pos();
+                    front_->template write<false>(data, space);
+                    data += space;
+                    size -= space;
+                    hand_off();
+                }
+
+                front_->template write<false>(data, size);
+                if (front_->full())
+                {
+                    hand_off();
                 }
             }
 
+        public:
+            async_ostream()
+                : flusher_([this] { run(); })
+            {}
+
+            async_ostream(const async_ostream &) = delete;
+            async_ostream &operator=(const async_ostream &) = delete;
+
+            /// Hands off anything buffered and waits until it has been written
             void flush()
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                if (buffer.pos() == 0)
+                if (front_->pos() != 0)
+                {
+                    hand_off();
+                }
+
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [this] { return back_ == nullptr; });
+            }
+
+            ~async_ostream()
+            {
+                flush();
                 {
+                    std::unique_lock lock(mutex_);
+                    stop_ = true;
+                }
+
+                cv_.notify_all();
+                flusher_.join();
+            }
+        };
+
+        /**
+         * \brief An ostream writing to a descriptor chosen at runtime.
+         *
+         * Batches and formats exactly like ostream, for log files, sockets or
+         * pipes. The descriptor is left open on destruction; file_ostream owns
+         * the one it opens.
+         */
+        template <
+            size_t Capacity,
+            bool UseHeap = Capacity >= 256,
+            typename Allocator = memory::system_array_resource<char>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<char>, Allocator>
+            >
+        >
+        class fd_ostream : public __output_base<fd_ostream<Capacity, UseHeap, Allocator>>
+        {
+            friend class __output_base<fd_ostream>;
+
+        protected:
+            ring_buffer<char, Capacity, UseHeap, Allocator> buffer; ///< Ring buffer to hold the output data
+            int fd_ = -1;
+            size_t block_ = 0; ///< Write granularity under O_DIRECT, 0 when unrestricted
+
+            fd_ostream() = default;
+
+            void do_write(const char *data, size_t size)
+            {
+                if (block_ == 0)
+                {
+                    __write_buffered<Capacity>(fd_, buffer, data, size);
                     return;
                 }
 
-#               ifdef _WIN32
-                if constexpr (FileDescriptor == STDOUT_FILENO)
+                // O_DIRECT needs every write to come from the aligned buffer
+                while (size > Capacity - buffer.pos())
                 {
-                    WriteConsoleA(stdout_handle, buffer.ptr(), buffer.pos(), nullptr, nullptr);
+                    const size_t space = Capacity - buffer.pos();
+                    buffer.template write<false>(data, space);
+                    data += space;
+                    size -= space;
+                    __flush_buffer(fd_, buffer);
                 }
-                else
+
+                buffer.template write<false>(data, size);
+                if (buffer.full())
                 {
-                    WriteConsoleA(stderr_handle, buffer.ptr(), buffer.pos(), nullptr, nullptr);
+                    __flush_buffer(fd_, buffer);
                 }
-#               else
-                write(FileDescriptor, buffer.ptr(), buffer.pos());
-#               endif
-                buffer.flush(); // Clear the buffer after writing
-#           else
-                std::cout.flush(); // Use standard output flush for Windows
-#           endif
             }
 
-            template <class T = string<>>
-            ostream &operator<<(T &&handle)
+        public:
+            explicit fd_ostream(const int fd)
+                : fd_(fd)
+            {}
+
+            fd_ostream(const fd_ostream &) = delete;
+            fd_ostream &operator=(const fd_ostream &) = delete;
+
+            [[nodiscard]] int fd() const
             {
-                do_write(handle.ptr(), handle.size());
-                return *this;
+                return fd_;
             }
 
-            ostream &operator<<(const bool val)
+            void flush()
             {
-                if (val)
+                if (block_ == 0)
                 {
-                    do_write("true", 4);
+                    __flush_buffer(fd_, buffer);
+                    return;
                 }
-                else
+
+                // Only whole blocks can go out under O_DIRECT, keep the tail for later
+                const size_t whole = buffer.pos() / block_ * block_;
+                if (whole == 0)
                 {
-                    do_write("false", 5);
+                    return;
                 }
 
-                return *this;
+                __write_fully(fd_, buffer.ptr(), whole);
+                const size_t rest = buffer.pos() - whole;
+                memmove(buffer.ptr(), buffer.ptr() + whole, rest);
+                buffer.flush();
+                buffer.commit(rest);
             }
 
-            template <
-                class T = display,
-                typename = std::enable_if_t<
-                   std::is_base_of_v<T, display>
-                >
-            >
-            ostream &operator<<(T &&d)
+            /**
+             * @brief Returns room for n contiguous bytes in the buffer, flushing
+             * first if needed, or nullptr if it cannot hold n bytes.
+             *
+             * Bytes written there become output once passed to commit().
+             */
+            char *reserve(const size_t n)
             {
-                auto val = d.serialize();
-                do_write(val.c_str(), val.size());
-                return *this;
+                return __reserve_buffered<Capacity>(buffer, n, [this] { flush(); });
             }
 
-            ostream &operator<<(const short val)
+            /// Publishes n bytes written into the space returned by reserve()
+            void commit(const size_t n)
             {
-                do_write_integral(val);
-                return *this;
+                __commit_buffered(buffer, n, [this] { flush(); });
             }
 
-            ostream &operator<<(const int val)
+            ~fd_ostream()
             {
-                do_write_integral(val);
-                return *this;
+                flush();
             }
+        };
+
+        /**
+         * \brief An fd_ostream that opens, and closes, a file by path.
+         *
+         * With file_options::direct the file is opened with O_DIRECT where the
+         * platform has it, which needs a block-aligned buffer: use
+         * memory::aligned_array_resource<char, direct_block> as the allocator
+         * and a Capacity that is a multiple of direct_block. Otherwise, or when
+         * appending, the flag is silently dropped.
+         */
+        template <
+            size_t Capacity,
+            bool UseHeap = Capacity >= 256,
+            typename Allocator = memory::system_array_resource<char>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<char>, Allocator>
+            >
+        >
+        class file_ostream : public fd_ostream<Capacity, UseHeap, Allocator>
+        {
+            using base = fd_ostream<Capacity, UseHeap, Allocator>;
 
-            ostream &operator<<(const long val)
+            void preallocate([[maybe_unused]] const size_t bytes)
             {
-                do_write_integral(val);
-                return *this;
+#           if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+                // Reserve the extents without changing the visible size; only a hint
+                fallocate(this->fd_, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(bytes));
+#           endif
             }
 
-            ostream &operator<<(const long long val)
+        public:
+            static constexpr size_t direct_block = 4096;
+
+            /**
+             * @brief Opens path for writing, creating it if needed.
+             * @throws except::io_error if the file cannot be opened.
+             */
+            explicit file_ostream(const char *path, const file_options &options = {})
             {
-                do_write_integral(val);
-                return *this;
+#           ifdef _WIN32
+                const int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (options.append ? _O_APPEND : _O_TRUNC);
+                this->fd_ = _open(path, flags, _S_IREAD | _S_IWRITE);
+#           else
+                int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (options.append ? O_APPEND : O_TRUNC);
+#               ifdef O_DIRECT
+                const bool direct = options.direct && !options.append &&
+                    Capacity % direct_block == 0 &&
+                    reinterpret_cast<uintptr_t>(this->buffer.ptr()) % direct_block == 0;
+
+                this->fd_ = open(path, direct ? flags | O_DIRECT : flags, 0644);
+                if (this->fd_ >= 0 && direct)
+                {
+                    this->block_ = direct_block;
+                }
+                else if (direct)
+                {
+                    // Some filesystems (tmpfs among them) refuse O_DIRECT
+                    this->fd_ = open(path, flags, 0644);
+                }
+#               else
+                this->fd_ = open(path, flags, 0644);
+#               endif
+#           endif
+
+                if (this->fd_ < 0)
+                {
+                    throw except::io_error("Failed to open file for writing");
+                }
+
+                if (options.preallocate != 0)
+                {
+                    preallocate(options.preallocate);
+                }
             }
 
-            ostream &operator<<(const unsigned short val)
+            /// Flushes and closes the file; further writes are discarded
+            void close()
             {
-                do_write_integral(val);
-                return *this;
+                if (this->fd_ < 0)
+                {
+                    return;
+                }
+
+#           ifdef O_DIRECT
+                if (this->block_ != 0)
+                {
+                    base::flush();
+
+                    // The tail is not a whole block, finish it through the page cache
+                    fcntl(this->fd_, F_SETFL, fcntl(this->fd_, F_GETFL) & ~O_DIRECT);
+                    this->block_ = 0;
+                }
+#           endif
+
+                base::flush();
+#           ifdef _WIN32
+                _close(this->fd_);
+#           else
+                ::close(this->fd_);
+#           endif
+                this->fd_ = -1;
             }
 
-            ostream &operator<<(const unsigned int val)
+            ~file_ostream()
             {
-                do_write_integral(val);
-                return *this;
+                close();
             }
+        };
+#       endif
+
+        /**
+         * \brief An ostream that many threads can write to without a lock.
+         *
+         * Writers format a record into a staging buffer on their own stack
+         * (see line()) and publish it into a bounded multi-producer ring with
+         * a single compare-and-swap. Whichever thread wins the drain flag copies
+         * published records into the underlying ostream in order; everyone
+         * else returns immediately. A record is written contiguously unless it
+         * is larger than the whole ring.
+         *
+         * Writing with << directly publishes every piece as its own record, so
+         * pieces from different threads may interleave; use line() to keep a
+         * whole line together.
+         */
+        template <
+            int FileDescriptor,
+            size_t Capacity,
+            bool UseHeap = Capacity >= 256,
+            typename Allocator = memory::system_array_resource<char>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<char>, Allocator>
+            >
+        >
+        class concurrent_ostream
+            : public __output_base<concurrent_ostream<FileDescriptor, Capacity, UseHeap, Allocator>>
+        {
+            friend class __output_base<concurrent_ostream>;
+
+            struct alignas(64) slot
+            {
+                std::atomic<size_t> sequence; ///< Position + 1 once published, position + ring_slots once drained
+                uint32_t size;
+                char data[64 - sizeof(std::atomic<size_t>) - sizeof(uint32_t)];
+            };
+
+            static constexpr size_t ring_slots = 256; ///< Must be a power of two
+            static constexpr size_t slot_payload = sizeof(slot::data);
 
-            ostream &operator<<(const unsigned long val)
+            slot slots_[ring_slots];
+            alignas(64) std::atomic<size_t> tail_ = 0; ///< Next position producers claim
+            alignas(64) std::atomic<bool> draining_ = false; ///< Held by the single writer
+            size_t head_ = 0; ///< Next position to drain, only touched by the writer
+            ostream<FileDescriptor, Capacity, UseHeap, Allocator> sink_;
+
+            void drain_locked()
             {
-                do_write_integral(val);
-                return *this;
+                while (true)
+                {
+                    slot &s = slots_[head_ & (ring_slots - 1)];
+                    if (s.sequence.load(std::memory_order_acquire) != head_ + 1)
+                    {
+                        return;
+                    }
+
+                    sink_.write(s.data, s.size);
+                    s.sequence.store(head_ + ring_slots, std::memory_order_release);
+                    ++head_;
+                }
             }
 
-            ostream &operator<<(const unsigned long long val)
+            /// Drains if no other thread is; returns false if another one is
+            bool try_drain()
             {
-                do_write_integral(val);
-                return *this;
+                while (true)
+                {
+                    // Test before the exchange so waiting producers don't bounce the line
+                    if (draining_.load(std::memory_order_seq_cst) ||
+                        draining_.exchange(true, std::memory_order_seq_cst))
+                    {
+                        return false;
+                    }
+
+                    drain_locked();
+                    const size_t next = head_;
+                    draining_.store(false, std::memory_order_seq_cst);
+
+                    // A producer that published after our last check but saw
+                    // the flag held would leave its record behind, so look again
+                    if (slots_[next & (ring_slots - 1)].sequence.load(std::memory_order_seq_cst) != next + 1)
+                    {
+                        return true;
+                    }
+                }
             }
 
-            ostream &operator<<(const float val)
+            /// Claims count consecutive slots, draining or yielding while the ring is full
+            size_t claim(const size_t count)
             {
-                do_write_integral(val);
-                return *this;
+                size_t pos = tail_.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    // The writer frees slots in order, so if the last one is free so are the rest
+                    const size_t last = pos + count - 1;
+                    const size_t seq = slots_[last & (ring_slots - 1)].sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<std::ptrdiff_t>(seq - last);
+
+                    if (diff == 0)
+                    {
+                        if (tail_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                        {
+                            return pos;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // Full, help the writer or wait for it
+                        if (!try_drain())
+                        {
+                            std::this_thread::yield();
+                        }
+
+                        pos = tail_.load(std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        pos = tail_.load(std::memory_order_relaxed);
+                    }
+                }
             }
 
-            ostream &operator<<(const double val)
+            void publish(const char *data, size_t size)
             {
-                do_write_integral(val);
-                return *this;
+                while (size != 0)
+                {
+                    const size_t needed = (size + slot_payload - 1) / slot_payload;
+                    const size_t count = needed < ring_slots ? needed : ring_slots;
+                    const size_t pos = claim(count);
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        slot &s = slots_[(pos + i) & (ring_slots - 1)];
+                        const size_t piece = size < slot_payload ? size : slot_payload;
+                        memcpy(s.data, data, piece);
+                        s.size = static_cast<uint32_t>(piece);
+                        data += piece;
+                        size -= piece;
+
+                        // The last store pairs with the writer's recheck in try_drain
+                        s.sequence.store(
+                            pos + i + 1,
+                            size == 0 ? std::memory_order_seq_cst : std::memory_order_release
+                        );
+                    }
+                }
+
+                try_drain();
             }
 
-            ostream &operator<<(const char *s)
+            void do_write(const char *data, const size_t size)
             {
-    #       ifdef ZELIX_STL_FULL_IO_SUPPORT
-                // Append the string on the fly
-                for (size_t i = 0; s[i] != '\0'; ++i)
+                publish(data, size);
+            }
+
+        public:
+            /**
+             * \brief A single record staged on the writing thread.
+             *
+             * Nothing is visible to other threads until commit(), which
+             * publishes the whole record at once. Records longer than
+             * max_record are published in max_record-sized pieces.
+             */
+            class record : public __output_base<record>
+            {
+                friend class __output_base<record>;
+                friend class concurrent_ostream;
+
+                static constexpr size_t max_record = 1024;
+
+                concurrent_ostream *owner_;
+                size_t len_ = 0;
+                char data_[max_record];
+
+                explicit record(concurrent_ostream &owner)
+                    : owner_(&owner)
+                {}
+
+                void do_write(const char *data, size_t size)
                 {
-                    if (buffer.full())
+                    while (len_ + size > max_record)
                     {
-                        flush(); ///< Flush the buffer if it's full
+                        const size_t space = max_record - len_;
+                        memcpy(data_ + len_, data, space);
+                        len_ = max_record;
+                        commit();
+                        data += space;
+                        size -= space;
                     }
 
-                    buffer.emplace_back(s[i]); ///< Add the character to the buffer
+                    memcpy(data_ + len_, data, size);
+                    len_ += size;
                 }
 
-    #       else
-                std::cout << s; ///< Use standard output for Windows
-    #       endif
-                return *this;
+            public:
+                record(const record &) = delete;
+                record &operator=(const record &) = delete;
+
+                /// Publishes everything written since the last commit
+                void commit()
+                {
+                    if (len_ != 0)
+                    {
+                        owner_->publish(data_, len_);
+                        len_ = 0;
+                    }
+                }
+
+                ~record()
+                {
+                    commit();
+                }
+            };
+
+            concurrent_ostream()
+            {
+                for (size_t i = 0; i < ring_slots; ++i)
+                {
+                    slots_[i].sequence.store(i, std::memory_order_relaxed);
+                }
             }
 
-            ostream &operator<<(const char s)
+            concurrent_ostream(const concurrent_ostream &) = delete;
+            concurrent_ostream &operator=(const concurrent_ostream &) = delete;
+
+            /**
+             * @brief Starts a record; the bytes are published by commit() or
+             * when the record goes out of scope.
+             *
+             * \code
+             * auto l = ccout.line();
+             * l << name << ": " << ms << " ms" << endl;
+             * l.commit();
+             * \endcode
+             */
+            [[nodiscard]] record line()
             {
-#       ifdef ZELIX_STL_FULL_IO_SUPPORT
-                if (buffer.full())
+                return record(*this);
+            }
+
+            /// Drains every published record and flushes the underlying stream
+            void flush()
+            {
+                while (draining_.exchange(true, std::memory_order_acquire))
                 {
-                    flush(); ///< Flush the buffer if it's full
+                    std::this_thread::yield();
                 }
 
-                buffer.emplace_back(s); ///< Add the character to the buffer
-#       else
-                std::cout << s; ///< Use standard output for Windows
-#       endif
-                return *this;
+                drain_locked();
+                sink_.flush();
+                draining_.store(false, std::memory_order_release);
             }
 
-            ~ostream()
+            ~concurrent_ostream()
             {
                 flush();
             }
         };
 
+        /**
+         * \brief Buffered reader for a file descriptor, the input side of ostream.
+         *
+         * Input is read in Capacity-sized blocks and handed out as external_string
+         * views into the buffer, so lines and tokens are never copied. A view is
+         * only valid until the next call that reads from the stream. Lines or
+         * tokens longer than Capacity are returned in Capacity-sized pieces.
+         *
+         * \tparam FileDescriptor Descriptor to read from; only stdin on Windows.
+         * \tparam Capacity       Size of the read buffer.
+         */
         template <
             int FileDescriptor,
             size_t Capacity,
@@ -334,173 +1110,231 @@ namespace zelix::stl
                 std::is_base_of_v<memory::array_resource<char>, Allocator>
             >
         >
-        class concurrent_ostream : ostream<FileDescriptor, Capacity, UseHeap, Allocator>
+        class istream
         {
-#       ifdef ZELIX_STL_FULL_IO_SUPPORT
-            // Mutex for thread-safe operations
-            std::mutex mutex_;
-#       endif
-
-        public:
-            concurrent_ostream()
-                : ostream<FileDescriptor, Capacity, UseHeap, Allocator>()
-            {}
+            ring_buffer<char, Capacity, UseHeap, Allocator> buffer; ///< Read data, pos() marks the end of it
+            size_t cursor_ = 0; ///< First byte not handed out yet
+            bool eof_ = false;
+            bool split_ = false; ///< Last read_until stopped at a full buffer, not at a delimiter
 
-            template <class T = string<>>
-            concurrent_ostream &operator<<(T &&handle)
+            static external_string view(const char *data, const size_t size)
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<T>(handle));
-                return *this;
+                return size == 0 ? external_string() : external_string(data, size);
             }
 
-            concurrent_ostream &operator<<(const bool val)
+            // Reads straight from the source, returns 0 at end of input or on error
+            static size_t read_raw(char *dst, const size_t n)
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
-            }
+#           if defined(ZELIX_STL_FULL_IO_SUPPORT) && defined(_WIN32)
+                DWORD got = 0;
+                if (!ReadFile(GetStdHandle(STD_INPUT_HANDLE), dst, static_cast<DWORD>(n), &got, nullptr))
+                {
+                    return 0;
+                }
 
-            template <
-                class T = display,
-                typename = std::enable_if_t<
-                   std::is_base_of_v<T, display>
-                >
-            >
-            concurrent_ostream &operator<<(T &&d)
-            {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(d)>(d));
-                return *this;
-            }
+                return got;
+#           elif defined(ZELIX_STL_FULL_IO_SUPPORT)
+                ssize_t read_bytes;
+                do
+                {
+                    read_bytes = ::read(FileDescriptor, dst, n);
+                } while (read_bytes < 0 && errno == EINTR);
 
-            concurrent_ostream &operator<<(const short val)
-            {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
+                return read_bytes > 0 ? static_cast<size_t>(read_bytes) : 0;
+#           else
+                std::cin.read(dst, static_cast<std::streamsize>(n));
+                return static_cast<size_t>(std::cin.gcount());
 #           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
             }
 
-            concurrent_ostream &operator<<(const int val)
+            /// Moves unread bytes to the front and reads more behind them
+            bool refill()
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
-            }
+                if (eof_) return false;
 
-            concurrent_ostream &operator<<(const long val)
-            {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
-            }
+                const size_t pending = buffer.pos() - cursor_;
+                if (cursor_ != 0)
+                {
+                    memmove(buffer.ptr(), buffer.ptr() + cursor_, pending);
+                    buffer.flush();
+                    buffer.commit(pending);
+                    cursor_ = 0;
+                }
 
-            concurrent_ostream &operator<<(const long long val)
-            {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
-            }
+                if (pending == Capacity) return false; // No room left
 
-            concurrent_ostream &operator<<(const unsigned short val)
-            {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
+                const size_t n = read_raw(buffer.ptr() + pending, Capacity - pending);
+                if (n == 0)
+                {
+                    eof_ = true;
+                    return false;
+                }
+
+                buffer.commit(n);
+                return true;
             }
 
-            concurrent_ostream &operator<<(const unsigned int val)
+            [[nodiscard]] size_t available() const
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
+                return buffer.pos() - cursor_;
             }
 
-            concurrent_ostream &operator<<(const unsigned long val)
+        public:
+            istream()
+                : buffer()
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
+#           ifdef _WIN32
+                static_assert(FileDescriptor == STDIN_FILENO, "Only stdin is supported on Windows");
 #           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
             }
 
-            concurrent_ostream &operator<<(const unsigned long long val)
+            istream(const istream &) = delete;
+            istream &operator=(const istream &) = delete;
+
+            /// Whether the source is exhausted and every buffered byte was consumed
+            [[nodiscard]] bool eof() const
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
+                return eof_ && available() == 0;
             }
 
-            concurrent_ostream &operator<<(const float val)
+            /**
+             * \brief Copies up to n bytes into dst.
+             *
+             * Large reads bypass the buffer once it is drained.
+             * \return The number of bytes copied, less than n only at end of input.
+             */
+            size_t read(char *dst, const size_t n)
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
+                split_ = false;
+                size_t copied = 0;
+                while (copied < n)
+                {
+                    if (available() == 0)
+                    {
+                        if (n - copied >= Capacity)
+                        {
+                            const size_t direct = eof_ ? 0 : read_raw(dst + copied, n - copied);
+                            if (direct == 0)
+                            {
+                                eof_ = true;
+                                break;
+                            }
+
+                            copied += direct;
+                            continue;
+                        }
+
+                        if (!refill()) break;
+                    }
+
+                    const size_t chunk = available() < n - copied ? available() : n - copied;
+                    memcpy(dst + copied, buffer.ptr() + cursor_, chunk);
+                    cursor_ += chunk;
+                    copied += chunk;
+                }
+
+                return copied;
             }
 
-            concurrent_ostream &operator<<(const double val)
+            /**
+             * \brief Reads up to the next delim, which is consumed but not returned.
+             *
+             * At the end of input the remaining bytes are returned without a
+             * delimiter. Lines longer than the buffer come back in Capacity-sized
+             * pieces, and the delimiter ending the last piece is still consumed.
+             * \return A view into the buffer, or none once the input is exhausted.
+             */
+            optional<external_string> read_until(const char delim)
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(val)>(val));
-                return *this;
+                // A piece cut at a full buffer already ended the line if the delimiter follows
+                if (split_)
+                {
+                    split_ = false;
+                    if ((available() != 0 || refill()) && buffer.ptr()[cursor_] == delim)
+                    {
+                        ++cursor_;
+                    }
+                }
+
+                size_t scanned = 0; // Bytes after cursor_ known not to be delim
+                while (true)
+                {
+                    const char *start = buffer.ptr() + cursor_;
+                    if (
+                        const size_t idx = str::find_char(start + scanned, available() - scanned, delim);
+                        idx != str::npos
+                    )
+                    {
+                        const size_t len = scanned + idx;
+                        cursor_ += len + 1;
+                        return optional<external_string>::some(view(start, len));
+                    }
+
+                    scanned = available();
+                    if (!refill())
+                    {
+                        // End of input or a full buffer, hand out what is there
+                        if (available() == 0) return optional<external_string>::none();
+
+                        const size_t len = available();
+                        const char *rest = buffer.ptr() + cursor_;
+                        cursor_ += len;
+                        split_ = !eof_;
+                        return optional<external_string>::some(view(rest, len));
+                    }
+                }
             }
 
-            concurrent_ostream &operator<<(const char *s)
+            /// Reads a line, without its '\n' or a '\r' before it
+            optional<external_string> read_line()
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(s)>(s));
-                return *this;
+                auto line = read_until('\n');
+                if (line.is_some())
+                {
+                    if (auto &l = line.get(); l.size() != 0 && l.ptr()[l.size() - 1] == '\r')
+                    {
+                        l.set_size(l.size() - 1);
+                    }
+                }
+
+                return line;
             }
 
-            concurrent_ostream &operator<<(const char s)
+            /**
+             * \brief Skips ASCII whitespace and reads the run of non-whitespace after it.
+             *
+             * The whitespace byte that ends the token is left in the stream.
+             * \return A view into the buffer, or none once the input is exhausted.
+             */
+            optional<external_string> read_token()
             {
-#           ifdef ZELIX_STL_FULL_IO_SUPPORT
-                std::unique_lock lock(mutex_);
-#           endif
-                ostream<FileDescriptor, Capacity, UseHeap, Allocator>::
-                    operator<<(stl::forward<decltype(s)>(s));
-                return *this;
+                const auto is_space = [](const char c)
+                {
+                    return c == ' ' || (c >= '\t' && c <= '\r');
+                };
+
+                split_ = false;
+
+                // Skip the separator
+                while (true)
+                {
+                    while (cursor_ != buffer.pos() && is_space(buffer.ptr()[cursor_])) ++cursor_;
+                    if (available() != 0 || !refill()) break;
+                }
+
+                if (available() == 0) return optional<external_string>::none();
+
+                size_t len = 0;
+                while (true)
+                {
+                    const char *start = buffer.ptr() + cursor_;
+                    while (len != available() && !is_space(start[len])) ++len;
+                    if (len != available() || !refill()) break;
+                }
+
+                const char *token = buffer.ptr() + cursor_;
+                cursor_ += len;
+                return optional<external_string>::some(view(token, len));
             }
         };
     }
@@ -517,7 +1351,29 @@ namespace zelix::stl
         size_t Capacity,
         bool UseHeap = Capacity >= 256
     >
-    using concurrent_ostream = pmr::ostream<FileDescriptor, Capacity, UseHeap>;
+    using concurrent_ostream = pmr::concurrent_ostream<FileDescriptor, Capacity, UseHeap>;
+
+#   ifdef ZELIX_STL_FULL_IO_SUPPORT
+    template <
+        int FileDescriptor,
+        size_t Capacity,
+        bool UseHeap = Capacity >= 256
+    >
+    using async_ostream = pmr::async_ostream<FileDescriptor, Capacity, UseHeap>;
+
+    template <size_t Capacity, bool UseHeap = Capacity >= 256>
+    using fd_ostream = pmr::fd_ostream<Capacity, UseHeap>;
+
+    template <size_t Capacity, bool UseHeap = Capacity >= 256>
+    using file_ostream = pmr::file_ostream<Capacity, UseHeap>;
+#   endif
+
+    template <
+        int FileDescriptor,
+        size_t Capacity,
+        bool UseHeap = Capacity >= 256
+    >
+    using istream = pmr::istream<FileDescriptor, Capacity, UseHeap>;
 
 #   ifndef _WIN32
     inline constexpr auto endl = "\n"; ///< Newline character for output streams
@@ -528,6 +1384,8 @@ namespace zelix::stl
     inline ostream<STDERR_FILENO, 1024> err; ///< Standard error stream
     inline auto &cout = out; ///< Alias for standard output stream
     inline auto &cerr = err; ///< Alias for standard error stream
+    inline istream<STDIN_FILENO, 16 * 1024> in; ///< Standard input stream
+    inline auto &cin = in; ///< Alias for standard input stream
 
 #   ifdef ZELIX_STL_USE_CONCURRENT_IO
     inline concurrent_ostream<STDOUT_FILENO, 1024> cstdout; ///< Standard output stream
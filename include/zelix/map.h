@@ -79,6 +79,20 @@ namespace zelix::stl
                 tree_.insert(key, value);
             }
 
+            /**
+             * \brief Replaces the contents of the map with an already sorted range.
+             *
+             * Runs in linear time by building a balanced tree directly.
+             *
+             * \param first Iterator to the smallest element.
+             * \param last Iterator one past the largest element.
+             */
+            template <typename Iterator>
+            void assign_sorted(Iterator first, Iterator last)
+            {
+                tree_.build_from_sorted(first, last);
+            }
+
             /**
              * \brief Removes a key (and its value) from the map.
              * \param key The key to remove.
@@ -99,11 +113,32 @@ namespace zelix::stl
                 return tree_.contains(key);
             }
 
+            /**
+             * \brief Finds the element associated with a key.
+             * \param key The key to look up.
+             * \return Iterator to the element, or end() if the key does not exist.
+             */
+            tree::iterator find(const Key &key)
+            {
+                return tree_.find(key);
+            }
+
+            /**
+             * \brief Gets the value associated with a key without throwing.
+             * \param key The key to look up.
+             * \return Pointer to the value, or nullptr if the key does not exist.
+             */
+            Value *try_get(const Key &key)
+            {
+                auto node = tree_.find_ptr(key);
+                return node ? &node->value : nullptr;
+            }
+
             /**
              * \brief Gets the value associated with a key.
              * \param key The key to look up.
              * \return Reference to the value associated with the key.
-             * \throws (implementation-defined) if the key does not exist.
+             * \throws except::element_not_found if the key does not exist.
              */
             Value &get(const Key &key)
             {
@@ -120,6 +155,47 @@ namespace zelix::stl
                 return get(key);
             }
 
+            /**
+             * \brief Returns an iterator to the first element whose key is not less than key.
+             * \param key The key to compare against.
+             * \return Iterator to the element, or end() if there is none.
+             */
+            tree::iterator lower_bound(const Key &key)
+            {
+                return tree_.lower_bound(key);
+            }
+
+            /**
+             * \brief Returns an iterator to the first element whose key is greater than key.
+             * \param key The key to compare against.
+             * \return Iterator to the element, or end() if there is none.
+             */
+            tree::iterator upper_bound(const Key &key)
+            {
+                return tree_.upper_bound(key);
+            }
+
+            /**
+             * \brief Returns the elements equal to key.
+             * \param key The key to look up.
+             * \return A view holding the matching elements (at most one).
+             */
+            iterator_range<typename tree::iterator> equal_range(const Key &key)
+            {
+                return tree_.equal_range(key);
+            }
+
+            /**
+             * \brief Returns a view over the elements whose key lies in [from, to).
+             * \param from Inclusive lower bound.
+             * \param to Exclusive upper bound.
+             * \return A view over the matching elements, in ascending order.
+             */
+            iterator_range<typename tree::iterator> range(const Key &from, const Key &to)
+            {
+                return tree_.range(from, to);
+            }
+
             /**
              * \brief Returns an iterator to the beginning of the map.
              * \return Iterator to the first element.
@@ -0,0 +1,340 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+
+#include "external_string.h"
+#include "range.h"
+#include "string_utils.h"
+#include "zelix/except/io_error.h"
+
+#if !defined(_WIN32) && defined(__has_include) && __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#   define ZELIX_STL_MMAP_FILE
+#elif defined(_WIN32) && defined(__has_include) && __has_include(<windows.h>)
+#   include <windows.h>
+#   define ZELIX_STL_WIN32_FILE_MAPPING
+#endif
+
+namespace zelix::stl
+{
+    /**
+     * \brief A read-only view of a whole file, backed by the page cache.
+     *
+     * The file is mapped with mmap on POSIX and CreateFileMapping on Windows,
+     * so no bytes are copied and pages are loaded on first touch. Platforms
+     * with neither fall back to reading the file into a heap buffer.
+     */
+    class mapped_file
+    {
+        const char *data_ = nullptr;
+        size_t size_ = 0;
+#   ifdef ZELIX_STL_WIN32_FILE_MAPPING
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = nullptr;
+#   endif
+
+        void release()
+        {
+#   if defined(ZELIX_STL_MMAP_FILE)
+            if (data_) munmap(const_cast<char *>(data_), size_);
+#   elif defined(ZELIX_STL_WIN32_FILE_MAPPING)
+            if (data_) UnmapViewOfFile(data_);
+            if (mapping_) CloseHandle(mapping_);
+            if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+            mapping_ = nullptr;
+            file_ = INVALID_HANDLE_VALUE;
+#   else
+            free(const_cast<char *>(data_));
+#   endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+    public:
+        /// Access pattern hints, forwarded to madvise where available
+        enum class advice
+        {
+            normal,
+            sequential, ///< Read ahead aggressively, drop pages behind
+            random, ///< Disable read-ahead
+            will_need ///< Start loading the whole file now
+        };
+
+        /// Iterates the lines of the file, without their '\n' (or "\r\n")
+        class line_iterator
+        {
+            const char *pos_;
+            const char *end_;
+            const char *next_; ///< Start of the line after the current one
+
+            void find_next()
+            {
+                const size_t idx = str::find_char(pos_, end_ - pos_, '\n');
+                next_ = idx == str::npos ? end_ : pos_ + idx + 1;
+            }
+
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = external_string;
+            using iterator_category = std::forward_iterator_tag;
+
+            line_iterator(const char *pos, const char *end) : pos_(pos), end_(end), next_(pos)
+            {
+                if (pos_ != end_) find_next();
+            }
+
+            external_string operator*() const
+            {
+                size_t len = next_ - pos_;
+                if (len != 0 && pos_[len - 1] == '\n') len--;
+                if (len != 0 && pos_[len - 1] == '\r') len--;
+                return len == 0 ? external_string() : external_string(pos_, len);
+            }
+
+            line_iterator &operator++()
+            {
+                pos_ = next_;
+                if (pos_ != end_) find_next();
+                return *this;
+            }
+
+            line_iterator operator++(int)
+            {
+                line_iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const line_iterator &other) const
+            {
+                return pos_ == other.pos_;
+            }
+
+            bool operator!=(const line_iterator &other) const
+            {
+                return pos_ != other.pos_;
+            }
+        };
+
+        /**
+         * @brief Maps the file at path for reading.
+         * @throws except::io_error if the file cannot be opened or mapped.
+         */
+        explicit mapped_file(const char *path)
+        {
+#   if defined(ZELIX_STL_MMAP_FILE)
+            const int fd = open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) throw except::io_error("Failed to open file for mapping");
+
+            struct stat st{};
+            if (fstat(fd, &st) != 0)
+            {
+                close(fd);
+                throw except::io_error("Failed to stat mapped file");
+            }
+
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ != 0)
+            {
+                void *mem = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mem == MAP_FAILED)
+                {
+                    close(fd);
+                    throw except::io_error("Failed to map file");
+                }
+
+                data_ = static_cast<const char *>(mem);
+            }
+
+            close(fd); // The mapping keeps the file alive
+#   elif defined(ZELIX_STL_WIN32_FILE_MAPPING)
+            file_ = CreateFileA(
+                path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+            );
+            if (file_ == INVALID_HANDLE_VALUE) throw except::io_error("Failed to open file for mapping");
+
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file_, &file_size))
+            {
+                release();
+                throw except::io_error("Failed to stat mapped file");
+            }
+
+            if (file_size.QuadPart != 0)
+            {
+                mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                const void *mem = mapping_ ? MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+                if (!mem)
+                {
+                    release();
+                    throw except::io_error("Failed to map file");
+                }
+
+                data_ = static_cast<const char *>(mem);
+                size_ = static_cast<size_t>(file_size.QuadPart);
+            }
+#   else
+            FILE *f = fopen(path, "rb");
+            if (!f) throw except::io_error("Failed to open file for mapping");
+
+            fseek(f, 0, SEEK_END);
+            const long len = ftell(f);
+            fseek(f, 0, SEEK_SET);
+            if (len > 0)
+            {
+                auto buf = static_cast<char *>(malloc(static_cast<size_t>(len)));
+                if (!buf || fread(buf, 1, static_cast<size_t>(len), f) != static_cast<size_t>(len))
+                {
+                    free(buf);
+                    fclose(f);
+                    throw except::io_error("Failed to read file");
+                }
+
+                data_ = buf;
+                size_ = static_cast<size_t>(len);
+            }
+
+            fclose(f);
+#   endif
+        }
+
+        mapped_file(const mapped_file &) = delete;
+        mapped_file &operator=(const mapped_file &) = delete;
+
+        mapped_file(mapped_file &&other) noexcept :
+            data_(other.data_), size_(other.size_)
+#   ifdef ZELIX_STL_WIN32_FILE_MAPPING
+            , file_(other.file_), mapping_(other.mapping_)
+#   endif
+        {
+            other.data_ = nullptr;
+            other.size_ = 0;
+#   ifdef ZELIX_STL_WIN32_FILE_MAPPING
+            other.file_ = INVALID_HANDLE_VALUE;
+            other.mapping_ = nullptr;
+#   endif
+        }
+
+        mapped_file &operator=(mapped_file &&other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                data_ = other.data_;
+                size_ = other.size_;
+                other.data_ = nullptr;
+                other.size_ = 0;
+#   ifdef ZELIX_STL_WIN32_FILE_MAPPING
+                file_ = other.file_;
+                mapping_ = other.mapping_;
+                other.file_ = INVALID_HANDLE_VALUE;
+                other.mapping_ = nullptr;
+#   endif
+            }
+
+            return *this;
+        }
+
+        ~mapped_file()
+        {
+            release();
+        }
+
+        /// Tells the kernel how the contents will be read; a no-op where unsupported
+        void advise(const advice a) const
+        {
+            if (!data_) return;
+
+#   if defined(ZELIX_STL_MMAP_FILE)
+            int flag = MADV_NORMAL;
+            switch (a)
+            {
+                case advice::sequential: flag = MADV_SEQUENTIAL; break;
+                case advice::random: flag = MADV_RANDOM; break;
+                case advice::will_need: flag = MADV_WILLNEED; break;
+                default: break;
+            }
+
+            madvise(const_cast<char *>(data_), size_, flag);
+#   elif defined(ZELIX_STL_WIN32_FILE_MAPPING) && defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+            if (a == advice::will_need)
+            {
+                WIN32_MEMORY_RANGE_ENTRY range{const_cast<char *>(data_), size_};
+                PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+            }
+#   endif
+        }
+
+        /// The whole file; valid for as long as the mapped_file is alive
+        [[nodiscard]] external_string view() const
+        {
+            return size_ == 0 ? external_string() : external_string(data_, size_);
+        }
+
+        [[nodiscard]] const char *data() const
+        {
+            return data_;
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] line_iterator begin() const
+        {
+            return {data_, data_ + size_};
+        }
+
+        [[nodiscard]] line_iterator end() const
+        {
+            return {data_ + size_, data_ + size_};
+        }
+
+        /// Every line in the file, a trailing newline does not start an empty line
+        [[nodiscard]] iterator_range<line_iterator> lines() const
+        {
+            return {begin(), end()};
+        }
+    };
+}
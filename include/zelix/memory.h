@@ -170,6 +170,40 @@ namespace zelix::stl
                ((x << 24) & 0xFF000000);
     }
 
+    /**
+     * \brief Counts the trailing zero bits of a non-zero value.
+     *
+     * \param x The value to scan. Must not be zero.
+     * \return The index of the lowest set bit.
+     */
+    [[nodiscard]] inline int count_trailing_zeros(const uint64_t x)
+    {
+#   if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(x);
+#   else
+        int n = 0;
+        while (((x >> n) & 1) == 0) ++n;
+        return n;
+#   endif
+    }
+
+    /**
+     * \brief Counts the leading zero bits of a non-zero value.
+     *
+     * \param x The value to scan. Must not be zero.
+     * \return The number of zero bits above the highest set bit.
+     */
+    [[nodiscard]] inline int count_leading_zeros(const uint64_t x)
+    {
+#   if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(x);
+#   else
+        int n = 0;
+        while (((x << n) & (uint64_t(1) << 63)) == 0) ++n;
+        return n;
+#   endif
+    }
+
     /**
      * \brief Sets a block of memory to zero.
      *
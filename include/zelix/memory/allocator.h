@@ -28,7 +28,13 @@
 //
 
 #pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 
+#include "os_pages.h"
+#include "zelix/probe.h"
 #include "zelix/list.h"
 #include "zelix/vector.h"
 #include "zelix/except/invalid_operation.h"
@@ -37,147 +43,211 @@ namespace zelix::stl::memory
 {
     namespace pmr
     {
+        /// Header at the start of every lazy_allocator page; slots follow it
+        struct __lazy_page
+        {
+            __lazy_page *next; ///< Previously allocated page
+            size_t used; ///< Slots handed out so far (bump index)
+            uint64_t *dead; ///< Bitmap of freed slots, only set during teardown
+        };
+
+        /**
+         * \brief Page-based pool allocator with an intrusive free list.
+         *
+         * Pages are obtained from PagePolicy and chained through their headers.
+         * Each page holds as many slots as fit in PagePolicy::round() of the
+         * requested Capacity, so OS-backed pages are filled completely. Freed
+         * slots are destroyed immediately and linked through their own storage.
+         *
+         * \tparam T Type of the objects to allocate.
+         * \tparam Capacity Minimum number of slots per page.
+         * \tparam FreeListGrowthFactor Unused, kept for compatibility.
+         * \tparam FreeListInitialCapacity Unused, kept for compatibility.
+         * \tparam CallDestructors Whether objects are destroyed on dealloc and teardown.
+         * \tparam Allocator Array resource backing the default page policy.
+         * \tparam InnerAllocator Unused, kept for compatibility.
+         * \tparam FreeListAllocator Unused, kept for compatibility.
+         * \tparam PagePolicy Source of raw pages (array_pages or os_pages).
+         */
         template <
             typename T,
-            size_t Capacity,
-            bool CallDestructors,
+            size_t Capacity = 256,
+            double FreeListGrowthFactor = 1.8,
+            size_t FreeListInitialCapacity = 25,
+            bool CallDestructors = true,
             typename Allocator = system_array_resource<T>,
+            typename InnerAllocator = void,
+            typename FreeListAllocator = system_array_resource<T *>,
+            typename PagePolicy = array_pages<T, Allocator>,
             typename = std::enable_if_t<
                 std::is_base_of_v<array_resource<T>, Allocator>
             >
         >
-        class page
+        class lazy_allocator
         {
-            unsigned char *buffer = nullptr;
-            size_t offset = 0;
+            /// Distance between slots; a freed slot must be able to hold the free-list link
+            static constexpr size_t stride = sizeof(T) > sizeof(void *)
+                ? sizeof(T)
+                : (sizeof(void *) + alignof(T) - 1) / alignof(T) * alignof(T);
 
-        public:
-            page()
+            static constexpr size_t slot_align = alignof(T) > alignof(__lazy_page) ? alignof(T) : alignof(__lazy_page);
+            static constexpr size_t slots_offset = (sizeof(__lazy_page) + slot_align - 1) / slot_align * slot_align;
+
+            size_t page_bytes = PagePolicy::round(slots_offset + Capacity * stride);
+            size_t capacity = (page_bytes - slots_offset) / stride; ///< Slots per page
+            __lazy_page *pages = nullptr; ///< Newest page first
+            void *free_list = nullptr;
+
+            static void *next_of(const void *slot)
             {
-                buffer = reinterpret_cast<unsigned char *>(Allocator::allocate(Capacity));
-                if (!buffer) throw std::bad_alloc();
+                void *next;
+                memcpy(&next, slot, sizeof(void *)); // slots are only guaranteed alignof(T)
+                return next;
             }
 
-            T *alloc(auto&&... args)
+            static unsigned char *slot_at(__lazy_page *page, const size_t i)
             {
-                if (offset >= Capacity)
-                {
-                    throw except::failed_alloc("Out of memory in lazy page allocator");
-                }
-
-                // Allocate the next object in the buffer
-                T* ptr = reinterpret_cast<T*>(buffer + offset * sizeof(T));
-                ++offset;
-                new (ptr) T(stl::forward<decltype(args)>(args)...); // Construct the object in place
-                return ptr;
+                return reinterpret_cast<unsigned char *>(page) + slots_offset + i * stride;
             }
 
-            [[nodiscard]] bool full() const
+            void dealloc_slot(void *slot)
             {
-                return offset >= Capacity;
+                memcpy(slot, &free_list, sizeof(void *));
+                free_list = slot;
             }
 
-            ~page()
+            // Marks every slot on the free list as dead so teardown skips their destructors
+            void mark_free_slots(uint64_t *map, const size_t n, const size_t words)
             {
-                if constexpr (!std::is_trivially_destructible_v<T> && CallDestructors)
+                auto sorted = static_cast<__lazy_page **>(malloc(n * sizeof(__lazy_page *)));
+                if (!sorted) return;
+
+                size_t i = 0;
+                for (auto page = pages; page; page = page->next, ++i)
                 {
-                    // Call the destructor of all allocated objects
-                    for (size_t i = 0; i < offset; ++i)
+                    page->dead = map + i * words;
+                    sorted[i] = page;
+                }
+
+                std::sort(sorted, sorted + n, std::less<__lazy_page *>());
+
+                for (void *slot = free_list; slot; slot = next_of(slot))
+                {
+                    // Last page starting before the slot
+                    size_t lo = 0, hi = n;
+                    while (lo < hi)
                     {
-                        T *ptr = reinterpret_cast<T*>(buffer + i * sizeof(T));
-                        ptr->~T(); // Call the destructor
+                        const size_t mid = (lo + hi) / 2;
+                        if (std::less<const void *>()(sorted[mid], slot)) lo = mid + 1;
+                        else hi = mid;
                     }
+
+                    __lazy_page *page = sorted[lo - 1];
+                    const size_t idx = (static_cast<unsigned char *>(slot) - slot_at(page, 0)) / stride;
+                    page->dead[idx / 64] |= uint64_t(1) << (idx % 64);
                 }
 
-                // Free the buffer memory
-                Allocator::deallocate(reinterpret_cast<T*>(buffer));
+                free(sorted);
             }
-        };
-
-        template <
-            typename T,
-            size_t Capacity = 256,
-            double FreeListGrowthFactor = 1.8,
-            size_t FreeListInitialCapacity = 25,
-            bool CallDestructors = true,
-            typename Allocator = system_array_resource<T>,
-            typename InnerAllocator = system_resource<
-                stl::pmr::__list_el<
-                    page<
-                        T,
-                        Capacity,
-                        CallDestructors,
-                        Allocator
-                    >
-                >
-            >,
-            typename FreeListAllocator = system_array_resource<T *>,
-            typename = std::enable_if_t<
-                std::is_base_of_v<array_resource<T>, Allocator>
-            >,
-            typename = std::enable_if_t<
-                std::is_base_of_v<
-                    resource<
-                        stl::pmr::__list_el<
-                            page<
-                                T,
-                                Capacity,
-                                CallDestructors,
-                                Allocator
-                            >
-                        >
-                    >,
-                    InnerAllocator
-                >
-            >,
-            typename = std::enable_if_t<
-                std::is_base_of_v<array_resource<T *>, FreeListAllocator>
-            >
-        >
-        class lazy_allocator
-        {
-            stl::pmr::list<page<T, Capacity, CallDestructors, Allocator>, InnerAllocator> pages;
-            stl::pmr::vector<T *, FreeListGrowthFactor, FreeListInitialCapacity, FreeListAllocator> free_list;
 
         public:
+            lazy_allocator() = default;
+            lazy_allocator(const lazy_allocator &) = delete;
+            lazy_allocator &operator=(const lazy_allocator &) = delete;
+
             T *alloc(auto&&... args)
             {
-                // Check the free list first
-                if (!free_list.empty())
+                // Reuse a freed slot first
+                if (free_list)
                 {
-                    T *ptr = free_list.pop_back_move();
-                    ptr->~T(); // Call the destructor
+                    void *slot = free_list;
+                    free_list = next_of(slot);
 
-                    new (ptr) T(stl::forward<decltype(args)>(args)...); // Placement new to construct the object
-                    return ptr;
+                    try
+                    {
+                        return new (slot) T(stl::forward<decltype(args)>(args)...);
+                    }
+                    catch (...)
+                    {
+                        dealloc_slot(slot);
+                        throw;
+                    }
                 }
 
-                // See if we have any pages available
-                if (pages.empty())
+                if (!pages || pages->used == capacity)
                 {
-                    pages.emplace_back();
+                    // Allocate a new page
+                    ZELIX_STL_PROBE1(lazy_allocator_page, page_bytes);
+                    pages = new (PagePolicy::map(page_bytes)) __lazy_page{pages, 0, nullptr};
                 }
 
-                auto &back = pages.back();
-                if (back.full())
+                // Allocate the next object in the page
+                T *ptr = new (slot_at(pages, pages->used)) T(stl::forward<decltype(args)>(args)...);
+                ++pages->used;
+                return ptr;
+            }
+
+            void dealloc(T *ptr)
+            {
+                if (!ptr) return;
+
+                if constexpr (!std::is_trivially_destructible_v<T> && CallDestructors)
                 {
-                    // Allocate a new page
-                    pages.emplace_back();
-                    return pages.back().alloc(stl::forward<decltype(args)>(args)...);
+                    ptr->~T(); // Destroy now, the slot only holds the free-list link afterwards
                 }
 
-                return back.alloc(stl::forward<decltype(args)>(args)...);
+                dealloc_slot(ptr);
             }
 
-            void dealloc(T *ptr)
+            /// Pages obtained from PagePolicy so far
+            [[nodiscard]] size_t page_count() const
+            {
+                size_t n = 0;
+                for (auto page = pages; page; page = page->next) ++n;
+                return n;
+            }
+
+            /// Bytes held in pages, whether their slots are live or free
+            [[nodiscard]] size_t held_bytes() const
             {
-                free_list.push_back(ptr);
+                return page_count() * page_bytes;
             }
 
             ~lazy_allocator()
             {
-                free_list.aggressive_destroy(); // Clear the free list without calling destructors
-                pages.clear(); // Clear the vector of pages
+                if constexpr (!std::is_trivially_destructible_v<T> && CallDestructors)
+                {
+                    uint64_t *map = nullptr;
+                    if (free_list)
+                    {
+                        size_t n = 0;
+                        for (auto page = pages; page; page = page->next) ++n;
+
+                        const size_t words = (capacity + 63) / 64;
+                        map = static_cast<uint64_t *>(calloc(n * words, sizeof(uint64_t)));
+                        if (map) mark_free_slots(map, n, words);
+                    }
+
+                    // Call the destructor of all live objects
+                    for (auto page = pages; page; page = page->next)
+                    {
+                        for (size_t i = 0; i < page->used; ++i)
+                        {
+                            if (page->dead && (page->dead[i / 64] >> (i % 64) & 1)) continue;
+                            reinterpret_cast<T *>(slot_at(page, i))->~T();
+                        }
+                    }
+
+                    free(map);
+                }
+
+                // Release every page
+                while (pages)
+                {
+                    __lazy_page *next = pages->next;
+                    PagePolicy::unmap(pages, page_bytes);
+                    pages = next;
+                }
             }
         };
     }
@@ -190,4 +260,4 @@ namespace zelix::stl::memory
         bool CallDestructors = true
     >
     using lazy_allocator = pmr::lazy_allocator<T, Capacity, FreeListGrowthFactor, FreeListInitialCapacity, CallDestructors>; ///< Default lazy allocator type using the default page size and destructor behavior
-}
\ No newline at end of file
+}
@@ -0,0 +1,331 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/7/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#include "array_resource.h"
+#include "resource.h"
+#include "zelix/except/failed_alloc.h"
+#include "zelix/forward.h"
+#include "zelix/move.h"
+
+namespace zelix::stl::memory
+{
+    /**
+     * \brief Bump-pointer arena for O(1) allocation of mixed sizes.
+     *
+     * Memory is carved sequentially out of chunks; individual objects are never
+     * freed. Instead, whole phases are dropped at once with reset() or by
+     * rewinding to a previously taken mark(). Destructors are not run when memory
+     * is dropped, so objects living in an arena must not own resources elsewhere
+     * (or must be destroyed by their owner first).
+     */
+    class arena
+    {
+        struct chunk
+        {
+            chunk *prev;
+            size_t size; ///< Usable bytes after the header
+        };
+
+        static constexpr size_t header_size =
+            (sizeof(chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        chunk *current_ = nullptr;
+        unsigned char *top_ = nullptr; ///< Next free byte in current_
+        unsigned char *end_ = nullptr; ///< One past the last byte of current_
+        size_t chunk_size_;
+
+        static unsigned char *data_of(chunk *c)
+        {
+            return reinterpret_cast<unsigned char *>(c) + header_size;
+        }
+
+        void push_chunk(const size_t min_size)
+        {
+            const size_t size = min_size > chunk_size_ ? min_size : chunk_size_;
+            auto c = static_cast<chunk *>(malloc(header_size + size));
+            if (!c) throw except::failed_alloc("Out of memory in arena");
+
+            c->prev = current_;
+            c->size = size;
+            current_ = c;
+            top_ = data_of(c);
+            end_ = top_ + size;
+        }
+
+        // Release chunks newer than keep
+        void pop_chunks(const chunk *keep)
+        {
+            while (current_ != keep)
+            {
+                chunk *prev = current_->prev;
+                free(current_);
+                current_ = prev;
+            }
+        }
+
+    public:
+        /// A position in the arena that can be rewound to
+        struct marker
+        {
+            chunk *chunk_;
+            unsigned char *top_;
+        };
+
+        /// Rewinds the arena to where it was on construction
+        class scope
+        {
+            arena &arena_;
+            marker mark_;
+
+        public:
+            explicit scope(arena &a) : arena_(a), mark_(a.mark()) {}
+
+            scope(const scope &) = delete;
+            scope &operator=(const scope &) = delete;
+
+            ~scope()
+            {
+                arena_.rewind(mark_);
+            }
+        };
+
+        explicit arena(const size_t chunk_size = 64 * 1024) : chunk_size_(chunk_size) {}
+
+        arena(const arena &) = delete;
+        arena &operator=(const arena &) = delete;
+
+        arena(arena &&other) noexcept :
+            current_(other.current_), top_(other.top_), end_(other.end_), chunk_size_(other.chunk_size_)
+        {
+            other.current_ = nullptr;
+            other.top_ = other.end_ = nullptr;
+        }
+
+        arena &operator=(arena &&other) noexcept
+        {
+            if (this != &other)
+            {
+                pop_chunks(nullptr);
+                current_ = other.current_;
+                top_ = other.top_;
+                end_ = other.end_;
+                chunk_size_ = other.chunk_size_;
+
+                other.current_ = nullptr;
+                other.top_ = other.end_ = nullptr;
+            }
+
+            return *this;
+        }
+
+        ~arena()
+        {
+            pop_chunks(nullptr);
+        }
+
+        /// Allocates bytes with the given alignment (a power of two)
+        void *allocate(const size_t bytes, const size_t align = alignof(std::max_align_t))
+        {
+            auto addr = reinterpret_cast<uintptr_t>(top_);
+            uintptr_t aligned = (addr + align - 1) & ~(align - 1);
+
+            if (!current_ || aligned > reinterpret_cast<uintptr_t>(end_) ||
+                bytes > static_cast<size_t>(reinterpret_cast<uintptr_t>(end_) - aligned))
+            {
+                push_chunk(bytes + align);
+                addr = reinterpret_cast<uintptr_t>(top_);
+                aligned = (addr + align - 1) & ~(align - 1);
+            }
+
+            top_ = reinterpret_cast<unsigned char *>(aligned + bytes);
+            return reinterpret_cast<void *>(aligned);
+        }
+
+        /// Grows or shrinks the most recent allocation in place, returns whether it could
+        bool resize_last(void *ptr, const size_t old_bytes, const size_t new_bytes)
+        {
+            auto p = static_cast<unsigned char *>(ptr);
+            if (!current_ || p + old_bytes != top_ || new_bytes > static_cast<size_t>(end_ - p))
+            {
+                return false;
+            }
+
+            top_ = p + new_bytes;
+            return true;
+        }
+
+        /// Gives the bytes back if ptr is the most recent allocation, otherwise does nothing
+        void release_last(void *ptr, const size_t bytes)
+        {
+            if (auto p = static_cast<unsigned char *>(ptr); current_ && p + bytes == top_)
+            {
+                top_ = p;
+            }
+        }
+
+        [[nodiscard]] marker mark() const
+        {
+            return {current_, top_};
+        }
+
+        /// Drops everything allocated after m was taken
+        void rewind(const marker m)
+        {
+            const chunk *c = current_;
+            while (c && c != m.chunk_) c = c->prev;
+
+            // The marker's chunk was already released by reset() or an earlier rewind()
+            if (!c && m.chunk_)
+            {
+                reset();
+                return;
+            }
+
+            // Never move forward within a chunk that was rewound past the marker
+            const bool same_chunk = c == current_;
+            pop_chunks(c);
+            if (!same_chunk || m.top_ < top_) top_ = m.top_;
+            end_ = current_ ? data_of(current_) + current_->size : nullptr;
+        }
+
+        /// Drops everything, keeping the oldest chunk for reuse
+        void reset()
+        {
+            if (!current_) return;
+
+            chunk *first = current_;
+            while (first->prev) first = first->prev;
+
+            pop_chunks(first);
+            top_ = data_of(first);
+            end_ = top_ + first->size;
+        }
+
+        /// Bytes handed out from the current chunk
+        [[nodiscard]] size_t used() const
+        {
+            return current_ ? static_cast<size_t>(top_ - data_of(current_)) : 0;
+        }
+    };
+
+    /// Arena shared by every arena resource with the same tag on the calling thread
+    template <typename Tag = void>
+    arena &thread_arena()
+    {
+        static thread_local arena instance;
+        return instance;
+    }
+
+    /**
+     * \brief Object resource allocating from the thread's arena for Tag.
+     *
+     * deallocate() runs the destructor and only reclaims memory when the object
+     * was the last allocation; everything else is dropped with the arena.
+     */
+    template <typename T, typename Tag = void>
+    class arena_resource : public resource<T>
+    {
+    public:
+        template <typename... Args>
+        static T *allocate(Args&&... args) ///< Allocate memory of given size
+        {
+            void *mem = thread_arena<Tag>().allocate(sizeof(T), alignof(T));
+            return new (mem) T(stl::forward<Args>(args)...);
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if (!ptr) return;
+
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                ptr->~T(); // Call the destructor
+            }
+
+            thread_arena<Tag>().release_last(ptr, sizeof(T));
+        }
+    };
+
+    /**
+     * \brief Array resource allocating from the thread's arena for Tag.
+     *
+     * Pairs with arena_resource: containers using either share one arena per tag.
+     * Reallocating the most recent block grows it in place.
+     */
+    template <typename T, typename Tag = void>
+    class arena_array_resource : public array_resource<T>
+    {
+    public:
+        static T *allocate(const size_t n) ///< Allocate memory for the given elements
+        {
+            return static_cast<T *>(thread_arena<Tag>().allocate(sizeof(T) * n, alignof(T)));
+        }
+
+        static T *reallocate(T *ptr, const size_t old_len, const size_t new_len) ///< Allocate memory for the given elements
+        {
+            arena &a = thread_arena<Tag>();
+            if (ptr && a.resize_last(ptr, sizeof(T) * old_len, sizeof(T) * new_len))
+            {
+                return ptr;
+            }
+
+            T *new_ptr = static_cast<T *>(a.allocate(sizeof(T) * new_len, alignof(T)));
+            if (!ptr) return new_ptr;
+
+            const size_t min_len = old_len < new_len ? old_len : new_len;
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                memcpy(static_cast<void *>(new_ptr), ptr, sizeof(T) * min_len);
+            }
+            else
+            {
+                // Move the existing elements to the new memory
+                for (size_t i = 0; i < min_len; ++i)
+                {
+                    new (&new_ptr[i]) T(stl::move(ptr[i]));
+                    ptr[i].~T(); // Call destructor for the moved-from element
+                }
+            }
+
+            return new_ptr;
+        }
+
+        static void deallocate(T *) ///< Deallocate memory at given pointer
+        {
+            // Memory is reclaimed when the arena is reset or rewound
+        }
+    };
+}
@@ -0,0 +1,470 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "array_resource.h"
+#include "arena.h"
+#include "resource.h"
+#include "zelix/except/failed_alloc.h"
+#include "zelix/forward.h"
+#include "zelix/move.h"
+
+namespace zelix::stl::memory
+{
+    /**
+     * \brief Abstract, stateful source of memory.
+     *
+     * The static resources in this directory are chosen per container type
+     * and shared by every container of that type. A memory_resource is an
+     * object instead: containers built with the polymorphic_resource and
+     * polymorphic_array_resource policies allocate from whichever instance
+     * is current for the thread, so each request or compilation unit can
+     * get its own pool and drop it in one go.
+     */
+    class memory_resource
+    {
+    public:
+        virtual ~memory_resource() = default;
+
+        /// Allocates bytes aligned to align (a power of two)
+        void *allocate(const size_t bytes, const size_t align = alignof(std::max_align_t))
+        {
+            return do_allocate(bytes, align);
+        }
+
+        /// Frees a block from allocate(), bytes and align must match the request
+        void deallocate(void *ptr, const size_t bytes, const size_t align = alignof(std::max_align_t))
+        {
+            do_deallocate(ptr, bytes, align);
+        }
+
+        /// Grows or shrinks a block in place, returns false when it has to move
+        bool resize(void *ptr, const size_t old_bytes, const size_t new_bytes)
+        {
+            return do_resize(ptr, old_bytes, new_bytes);
+        }
+
+    protected:
+        virtual void *do_allocate(size_t bytes, size_t align) = 0;
+        virtual void do_deallocate(void *ptr, size_t bytes, size_t align) = 0;
+
+        virtual bool do_resize(void *, size_t, size_t)
+        {
+            return false;
+        }
+    };
+
+    /// Resource backed by the global operator new and delete
+    class new_delete_memory_resource final : public memory_resource
+    {
+    protected:
+        void *do_allocate(const size_t bytes, const size_t align) override
+        {
+            void *ptr = operator new(bytes, std::align_val_t(align), std::nothrow);
+            if (!ptr) throw except::failed_alloc("Out of memory in new_delete_memory_resource");
+            return ptr;
+        }
+
+        void do_deallocate(void *ptr, const size_t, const size_t align) override
+        {
+            operator delete(ptr, std::align_val_t(align));
+        }
+    };
+
+    /// The process-wide new/delete resource
+    inline memory_resource *new_delete_resource()
+    {
+        static new_delete_memory_resource instance;
+        return &instance;
+    }
+
+    inline std::atomic<memory_resource *> __default_resource{nullptr}; ///< Set with set_default_resource()
+    inline thread_local memory_resource *__scoped_resource = nullptr; ///< Innermost resource_scope of the thread
+
+    /**
+     * \brief The resource polymorphic policies allocate from on this thread.
+     *
+     * That is the innermost resource_scope, else the one given to
+     * set_default_resource(), else new_delete_resource().
+     */
+    inline memory_resource *get_default_resource()
+    {
+        if (__scoped_resource) return __scoped_resource;
+        if (auto *r = __default_resource.load(std::memory_order_acquire)) return r;
+        return new_delete_resource();
+    }
+
+    /// Replaces the process-wide default, nullptr restores new_delete_resource(); returns the old one
+    inline memory_resource *set_default_resource(memory_resource *r)
+    {
+        return __default_resource.exchange(r, std::memory_order_acq_rel);
+    }
+
+    /**
+     * \brief Makes r the current resource of the calling thread until destroyed.
+     *
+     * Scopes nest; blocks allocated inside a scope remember their resource,
+     * so they can still be grown and freed after it ends.
+     */
+    class resource_scope
+    {
+        memory_resource *previous_;
+
+    public:
+        explicit resource_scope(memory_resource &r) : previous_(__scoped_resource)
+        {
+            __scoped_resource = &r;
+        }
+
+        resource_scope(const resource_scope &) = delete;
+        resource_scope &operator=(const resource_scope &) = delete;
+
+        ~resource_scope()
+        {
+            __scoped_resource = previous_;
+        }
+    };
+
+    /**
+     * \brief Resource carving every block out of its own arena.
+     *
+     * Deallocation only gives memory back for the most recent block and
+     * resize grows it in place, so a vector being filled reallocates for
+     * free. Everything goes at once with release() or on destruction.
+     */
+    class arena_memory_resource final : public memory_resource
+    {
+        arena arena_;
+
+    protected:
+        void *do_allocate(const size_t bytes, const size_t align) override
+        {
+            return arena_.allocate(bytes, align);
+        }
+
+        void do_deallocate(void *ptr, const size_t bytes, size_t) override
+        {
+            arena_.release_last(ptr, bytes);
+        }
+
+        bool do_resize(void *ptr, const size_t old_bytes, const size_t new_bytes) override
+        {
+            return arena_.resize_last(ptr, old_bytes, new_bytes);
+        }
+
+    public:
+        explicit arena_memory_resource(const size_t chunk_size = 64 * 1024) : arena_(chunk_size) {}
+
+        /// Drops every block, keeping the first chunk for reuse
+        void release()
+        {
+            arena_.reset();
+        }
+
+        arena &get_arena()
+        {
+            return arena_;
+        }
+    };
+
+    /**
+     * \brief Resource with per-size free lists, for churn within one owner.
+     *
+     * Blocks up to max_pooled bytes are rounded to a power of two, taken
+     * from an arena and recycled through a free list per size; larger ones
+     * come from upstream and are kept on a list. release() or the destructor
+     * returns all of it. Not synchronized, use one per thread.
+     */
+    class pool_memory_resource final : public memory_resource
+    {
+        static constexpr size_t min_pooled = 16;
+        static constexpr size_t max_pooled = 4096;
+        static constexpr size_t classes = 9; ///< 16, 32, ..., 4096
+
+        /// Header right in front of an upstream block
+        struct large_block
+        {
+            large_block *prev;
+            large_block *next;
+            void *raw; ///< Start of the upstream allocation
+            size_t bytes; ///< Size of the upstream allocation
+            size_t align; ///< Alignment it was requested with
+        };
+
+        memory_resource *upstream_;
+        arena arena_;
+        void *free_[classes] = {};
+        large_block *large_ = nullptr;
+
+        static size_t class_of(const size_t bytes)
+        {
+            size_t c = 0;
+            for (size_t size = min_pooled; size < bytes; size <<= 1) ++c;
+            return c;
+        }
+
+        static bool pooled(const size_t bytes, const size_t align)
+        {
+            return bytes <= max_pooled && align <= alignof(std::max_align_t);
+        }
+
+        static large_block *header_of(void *ptr)
+        {
+            return static_cast<large_block *>(ptr) - 1;
+        }
+
+        void unlink(large_block *block)
+        {
+            if (block->prev) block->prev->next = block->next;
+            else large_ = block->next;
+            if (block->next) block->next->prev = block->prev;
+        }
+
+    protected:
+        void *do_allocate(const size_t bytes, const size_t align) override
+        {
+            if (pooled(bytes, align))
+            {
+                const size_t c = class_of(bytes);
+                if (void *slot = free_[c])
+                {
+                    memcpy(&free_[c], slot, sizeof(void *));
+                    return slot;
+                }
+
+                const size_t size = min_pooled << c;
+                return arena_.allocate(size, size < alignof(std::max_align_t) ? size : alignof(std::max_align_t));
+            }
+
+            // The header must end exactly where the aligned block starts
+            const size_t a = align > alignof(large_block) ? align : alignof(large_block);
+            const size_t offset = (sizeof(large_block) + a - 1) / a * a;
+            void *raw = upstream_->allocate(offset + bytes, a);
+
+            auto *block = header_of(static_cast<unsigned char *>(raw) + offset);
+            *block = large_block{nullptr, large_, raw, offset + bytes, a};
+            if (large_) large_->prev = block;
+            large_ = block;
+            return block + 1;
+        }
+
+        void do_deallocate(void *ptr, const size_t bytes, const size_t align) override
+        {
+            if (!ptr) return;
+
+            if (pooled(bytes, align))
+            {
+                const size_t c = class_of(bytes);
+                memcpy(ptr, &free_[c], sizeof(void *));
+                free_[c] = ptr;
+                return;
+            }
+
+            large_block *block = header_of(ptr);
+            unlink(block);
+            upstream_->deallocate(block->raw, block->bytes, block->align);
+        }
+
+    public:
+        explicit pool_memory_resource(memory_resource *upstream = new_delete_resource(), const size_t chunk_size = 64 * 1024) :
+            upstream_(upstream), arena_(chunk_size)
+        {
+        }
+
+        pool_memory_resource(const pool_memory_resource &) = delete;
+        pool_memory_resource &operator=(const pool_memory_resource &) = delete;
+
+        ~pool_memory_resource() override
+        {
+            release();
+        }
+
+        /// Frees every block at once; destructors of what lived in them are not run
+        void release()
+        {
+            while (large_)
+            {
+                large_block *block = large_;
+                large_ = block->next;
+                upstream_->deallocate(block->raw, block->bytes, block->align);
+            }
+
+            arena_.reset();
+            for (auto &head : free_) head = nullptr;
+        }
+    };
+
+    /// Bytes in front of a polymorphic block, keeping the block aligned for T
+    template <typename T>
+    inline constexpr size_t __polymorphic_header =
+        (2 * sizeof(void *) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    template <typename T>
+    inline constexpr size_t __polymorphic_align = alignof(T) > alignof(void *) ? alignof(T) : alignof(void *);
+
+    /// Resource and element count stored right before a polymorphic block
+    struct __polymorphic_tag
+    {
+        memory_resource *resource;
+        size_t count;
+    };
+
+    static inline __polymorphic_tag __read_tag(const void *ptr)
+    {
+        __polymorphic_tag tag;
+        memcpy(&tag, static_cast<const unsigned char *>(ptr) - sizeof(tag), sizeof(tag));
+        return tag;
+    }
+
+    static inline void __write_tag(void *ptr, const __polymorphic_tag tag)
+    {
+        memcpy(static_cast<unsigned char *>(ptr) - sizeof(tag), &tag, sizeof(tag));
+    }
+
+    /**
+     * \brief Object resource allocating from get_default_resource().
+     *
+     * Each object remembers the memory_resource it came from, which is
+     * where it goes back on deallocate(), whatever is current by then.
+     */
+    template <typename T>
+    class polymorphic_resource : public resource<T>
+    {
+        static constexpr size_t header = __polymorphic_header<T>;
+        static constexpr size_t align = __polymorphic_align<T>;
+
+    public:
+        template <typename... Args>
+        static T *allocate(Args&&... args) ///< Allocate memory of given size
+        {
+            memory_resource *r = get_default_resource();
+            auto *raw = static_cast<unsigned char *>(r->allocate(header + sizeof(T), align));
+            __write_tag(raw + header, {r, 1});
+
+            try
+            {
+                return new (raw + header) T(stl::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                r->deallocate(raw, header + sizeof(T), align);
+                throw;
+            }
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if (!ptr) return;
+
+            const __polymorphic_tag tag = __read_tag(ptr);
+            ptr->~T();
+            tag.resource->deallocate(reinterpret_cast<unsigned char *>(ptr) - header, header + sizeof(T), align);
+        }
+    };
+
+    /**
+     * \brief Array resource allocating from get_default_resource().
+     *
+     * Opt-in stateful mode for any container taking an array resource, e.g.
+     * `pmr::vector<T, 1.8, 10, polymorphic_array_resource<T>>`: blocks are
+     * drawn from the resource current when they are first allocated, and
+     * keep growing and are freed there, so a container filled inside a
+     * resource_scope stays on that pool. The static resources remain the
+     * default and pay none of this.
+     */
+    template <typename T>
+    class polymorphic_array_resource : public array_resource<T>
+    {
+        static constexpr size_t header = __polymorphic_header<T>;
+        static constexpr size_t align = __polymorphic_align<T>;
+
+        static T *allocate_from(memory_resource *r, const size_t n)
+        {
+            auto *raw = static_cast<unsigned char *>(r->allocate(header + n * sizeof(T), align));
+            __write_tag(raw + header, {r, n});
+            return reinterpret_cast<T *>(raw + header);
+        }
+
+        static unsigned char *raw_of(T *ptr)
+        {
+            return reinterpret_cast<unsigned char *>(ptr) - header;
+        }
+
+    public:
+        static T *allocate(const size_t n) ///< Allocate memory for the given elements
+        {
+            return allocate_from(get_default_resource(), n);
+        }
+
+        static T *reallocate(T *ptr, const size_t old_len, const size_t new_len) ///< Allocate memory for the given elements
+        {
+            if (!ptr) return allocate(new_len);
+
+            const __polymorphic_tag tag = __read_tag(ptr);
+            if (tag.resource->resize(raw_of(ptr), header + tag.count * sizeof(T), header + new_len * sizeof(T)))
+            {
+                __write_tag(ptr, {tag.resource, new_len});
+                return ptr;
+            }
+
+            T *moved = allocate_from(tag.resource, new_len);
+            const size_t kept = old_len < new_len ? old_len : new_len;
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                memcpy(static_cast<void *>(moved), static_cast<const void *>(ptr), kept * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = 0; i < kept; ++i)
+                {
+                    new (&moved[i]) T(stl::move(ptr[i]));
+                    ptr[i].~T();
+                }
+            }
+
+            tag.resource->deallocate(raw_of(ptr), header + tag.count * sizeof(T), align);
+            return moved;
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if (!ptr) return;
+
+            const __polymorphic_tag tag = __read_tag(ptr);
+            tag.resource->deallocate(raw_of(ptr), header + tag.count * sizeof(T), align);
+        }
+    };
+}
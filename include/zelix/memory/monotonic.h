@@ -52,6 +52,11 @@ namespace zelix::stl::memory
         {
             return allocator.dealloc(ptr);
         }
+
+        static size_t held_bytes() ///< Bytes held in pages by the shared allocator
+        {
+            return allocator.held_bytes();
+        }
     };
 
     template <typename T>
@@ -73,6 +78,12 @@ namespace zelix::stl::memory
             std::unique_lock lock(mutex_);
             return allocator.dealloc(ptr);
         }
+
+        static size_t held_bytes() ///< Bytes held in pages by the shared allocator
+        {
+            std::unique_lock lock(mutex_);
+            return allocator.held_bytes();
+        }
     };
 
     template <typename T>
@@ -91,5 +102,10 @@ namespace zelix::stl::memory
         {
             return allocator.dealloc(ptr);
         }
+
+        static size_t held_bytes() ///< Bytes held in pages by the calling thread's allocator
+        {
+            return allocator.held_bytes();
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "array_resource.h"
+#include "system_resource.h"
+#include "zelix/math_utils.h"
+#include "zelix/move.h"
+
+#if defined(ZELIX_STL_USE_LIBNUMA) && defined(__has_include) && __has_include(<numa.h>)
+#   include <numa.h>
+#   include <sched.h>
+#   define ZELIX_STL_LIBNUMA
+#elif defined(__linux__) && defined(__has_include) && __has_include(<sys/syscall.h>) && __has_include(<sys/mman.h>)
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define ZELIX_STL_NUMA_SYSCALLS
+#endif
+
+namespace zelix::stl::memory
+{
+    /**
+     * \brief NUMA node of the CPU the calling thread is running on.
+     *
+     * Uses libnuma when ZELIX_STL_USE_LIBNUMA is defined (link with -lnuma),
+     * the getcpu system call on other Linux builds, and is 0 elsewhere.
+     */
+    inline int numa_node()
+    {
+#   if defined(ZELIX_STL_LIBNUMA)
+        if (numa_available() >= 0)
+        {
+            const int cpu = sched_getcpu();
+            if (cpu >= 0) return numa_node_of_cpu(cpu);
+        }
+#   elif defined(ZELIX_STL_NUMA_SYSCALLS) && defined(SYS_getcpu)
+        unsigned cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return static_cast<int>(node);
+#   endif
+        return 0;
+    }
+
+    /**
+     * \brief Maps at least bytes of memory placed on the calling thread's node.
+     *
+     * \param mapped Set to the length to pass to __numa_unmap().
+     * \return The mapping, or nullptr when node placement is unavailable.
+     */
+    inline void *__numa_map(const size_t bytes, size_t &mapped)
+    {
+#   if defined(ZELIX_STL_LIBNUMA)
+        if (numa_available() < 0) return nullptr;
+
+        mapped = bytes;
+        return numa_alloc_local(bytes);
+#   elif defined(ZELIX_STL_NUMA_SYSCALLS)
+        static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        mapped = (bytes + page - 1) / page * page;
+
+        void *ptr = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) return nullptr;
+
+#       if defined(SYS_mbind)
+        // Pages are only placed on first touch, prefer our node for them then. Kernels
+        // without NUMA reject the call, the mapping is still fine to use
+        constexpr int preferred = 1; // MPOL_PREFERRED
+        const int node = numa_node();
+        if (node >= 0 && node < static_cast<int>(sizeof(unsigned long) * 8))
+        {
+            const unsigned long mask = 1UL << node;
+            syscall(SYS_mbind, ptr, mapped, preferred, &mask, sizeof(mask) * 8 + 1, 0);
+        }
+#       endif
+
+        return ptr;
+#   else
+        mapped = 0;
+        return nullptr;
+#   endif
+    }
+
+    inline void __numa_unmap(void *ptr, const size_t mapped)
+    {
+#   if defined(ZELIX_STL_LIBNUMA)
+        numa_free(ptr, mapped);
+#   elif defined(ZELIX_STL_NUMA_SYSCALLS)
+        munmap(ptr, mapped);
+#   else
+        (void) ptr;
+        (void) mapped;
+#   endif
+    }
+
+    /**
+     * \brief Array resource placing blocks on the NUMA node of the allocating thread.
+     *
+     * Blocks of at least MinMappedBytes are mapped straight from the kernel
+     * and bound (preferred) to the caller's node, so a worker filling its
+     * own buffers keeps them local on multi-socket machines. Smaller blocks
+     * come from the aligned heap, where placement is whatever the pages
+     * already had. Every block starts on a cache line.
+     *
+     * \tparam T Element type.
+     * \tparam MinMappedBytes Smallest block worth a mapping of its own.
+     */
+    template <typename T, size_t MinMappedBytes = 64 * 1024>
+    class numa_array_resource : public array_resource<T>
+    {
+        /// Bytes in front of each block holding its mapping length, 0 for heap blocks
+        static constexpr size_t header = alignof(T) > cache_line_size ? alignof(T) : cache_line_size;
+
+        static unsigned char *raw_of(T *ptr)
+        {
+            return reinterpret_cast<unsigned char *>(ptr) - header;
+        }
+
+    public:
+        static T *allocate(size_t n) ///< Allocate memory for the given elements
+        {
+            const size_t bytes = header + n * sizeof(T);
+            size_t mapped = 0;
+            void *raw = bytes >= MinMappedBytes ? __numa_map(bytes, mapped) : nullptr;
+            if (!raw)
+            {
+                mapped = 0;
+                raw = operator new(bytes, std::align_val_t(header));
+            }
+
+            memcpy(raw, &mapped, sizeof(size_t));
+            return reinterpret_cast<T *>(static_cast<unsigned char *>(raw) + header);
+        }
+
+        static T *reallocate(T *ptr, const size_t old_len, const size_t new_len) ///< Allocate memory for the given elements
+        {
+            T *new_ptr = allocate(new_len);
+            if (!ptr) return new_ptr;
+
+            const size_t min_len = min(old_len, new_len);
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (min_len != 0) memcpy(static_cast<void *>(new_ptr), static_cast<const void *>(ptr), sizeof(T) * min_len);
+            }
+            else
+            {
+                // Move the existing elements to the new memory
+                for (size_t i = 0; i < min_len; ++i)
+                {
+                    new (&new_ptr[i]) T(stl::move(ptr[i]));
+                    ptr[i].~T(); // Call destructor for the moved-from element
+                }
+            }
+
+            deallocate(ptr);
+            return new_ptr;
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if (!ptr) return;
+
+            unsigned char *raw = raw_of(ptr);
+            size_t mapped;
+            memcpy(&mapped, raw, sizeof(size_t));
+
+            if (mapped != 0) __numa_unmap(raw, mapped);
+            else operator delete(raw, std::align_val_t(header));
+        }
+    };
+}
@@ -0,0 +1,177 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/6/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "system_resource.h"
+#include "zelix/except/failed_alloc.h"
+
+#if !defined(_WIN32) && defined(__has_include) && __has_include(<sys/mman.h>)
+#   include <sys/mman.h>
+#   include <unistd.h>
+#   define ZELIX_STL_MMAP_PAGES
+#elif defined(_WIN32) && defined(__has_include) && __has_include(<windows.h>)
+#   include <windows.h>
+#   define ZELIX_STL_VIRTUAL_ALLOC_PAGES
+#endif
+
+namespace zelix::stl::memory
+{
+    /**
+     * \brief Page policy that carves pages out of an array resource.
+     *
+     * Page policies provide raw storage for lazy_allocator pages:
+     * `round(bytes)` returns the usable size of a mapping of at least `bytes`,
+     * `map(bytes)` returns storage for a rounded size, and `unmap(ptr, bytes)`
+     * releases it again.
+     *
+     * \tparam T Element type of the array resource.
+     * \tparam Allocator Array resource used for the storage.
+     */
+    template <
+        typename T,
+        typename Allocator = system_array_resource<T>,
+        typename = std::enable_if_t<
+            std::is_base_of_v<array_resource<T>, Allocator>
+        >
+    >
+    struct array_pages
+    {
+        static constexpr size_t round(const size_t bytes)
+        {
+            return (bytes + sizeof(T) - 1) / sizeof(T) * sizeof(T);
+        }
+
+        static void *map(const size_t bytes)
+        {
+            void *ptr = Allocator::allocate(bytes / sizeof(T));
+            if (!ptr) throw except::failed_alloc("Out of memory in lazy page allocator");
+            return ptr;
+        }
+
+        static void unmap(void *ptr, size_t)
+        {
+            Allocator::deallocate(static_cast<T *>(ptr));
+        }
+    };
+
+    /**
+     * \brief Page policy that maps pages straight from the operating system.
+     *
+     * Uses mmap on POSIX and VirtualAlloc on Windows, rounding every page up to
+     * the system page size so the slot capacity fills it. With HugePages, pages
+     * are rounded and aligned to 2 MiB and advised as transparent huge pages
+     * (large pages on Windows, falling back to regular ones when unavailable).
+     *
+     * \tparam HugePages Whether to request huge pages.
+     */
+    template <bool HugePages = false>
+    struct os_pages
+    {
+        static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+        static size_t granularity()
+        {
+            if constexpr (HugePages) return huge_page_size;
+
+#           if defined(ZELIX_STL_MMAP_PAGES)
+            static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+#           elif defined(ZELIX_STL_VIRTUAL_ALLOC_PAGES)
+            static const size_t size = []
+            {
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                return static_cast<size_t>(info.dwAllocationGranularity);
+            }();
+            return size;
+#           else
+            return 4096;
+#           endif
+        }
+
+        static size_t round(const size_t bytes)
+        {
+            const size_t g = granularity();
+            return (bytes + g - 1) / g * g;
+        }
+
+        static void *map(const size_t bytes)
+        {
+#           if defined(ZELIX_STL_MMAP_PAGES)
+            // Over-map so the range can be trimmed to a huge page boundary
+            const size_t extra = HugePages ? huge_page_size : 0;
+            void *raw = mmap(nullptr, bytes + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) throw except::failed_alloc("Out of memory in lazy page allocator");
+
+            auto ptr = static_cast<unsigned char *>(raw);
+            if constexpr (HugePages)
+            {
+                const auto addr = reinterpret_cast<uintptr_t>(ptr);
+                const size_t head = (huge_page_size - addr % huge_page_size) % huge_page_size;
+                if (head) munmap(ptr, head);
+                if (extra - head) munmap(ptr + head + bytes, extra - head);
+                ptr += head;
+
+#               ifdef MADV_HUGEPAGE
+                madvise(ptr, bytes, MADV_HUGEPAGE);
+#               endif
+            }
+
+            return ptr;
+#           elif defined(ZELIX_STL_VIRTUAL_ALLOC_PAGES)
+            void *ptr = nullptr;
+            if constexpr (HugePages)
+            {
+                ptr = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            }
+
+            if (!ptr) ptr = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (!ptr) throw except::failed_alloc("Out of memory in lazy page allocator");
+            return ptr;
+#           else
+            return ::operator new(bytes, std::align_val_t(granularity()));
+#           endif
+        }
+
+        static void unmap(void *ptr, [[maybe_unused]] const size_t bytes)
+        {
+#           if defined(ZELIX_STL_MMAP_PAGES)
+            munmap(ptr, bytes);
+#           elif defined(ZELIX_STL_VIRTUAL_ALLOC_PAGES)
+            VirtualFree(ptr, 0, MEM_RELEASE);
+#           else
+            ::operator delete(ptr, std::align_val_t(granularity()));
+#           endif
+        }
+    };
+}
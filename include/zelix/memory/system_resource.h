@@ -29,6 +29,8 @@
 
 #pragma once
 #include <cstdlib>
+#include <cstring>
+#include <new>
 
 
 #include "array_resource.h"
@@ -36,9 +38,19 @@
 #include "zelix/forward.h"
 #include "zelix/math_utils.h"
 #include "zelix/move.h"
+#include "zelix/relocatable.h"
 
 namespace zelix::stl::memory
 {
+    /// Whether raw storage for T is managed with malloc/realloc/free instead of operator new/delete.
+    /// Allocation and release must agree on this, otherwise the pair is mismatched.
+    /// Trivially relocatable types qualify since realloc moving their bytes is a valid move
+    template <typename T>
+    inline constexpr bool uses_malloc_v = is_trivially_relocatable_v<T>;
+
+    /// Cache line size assumed for padding and aligned allocations
+    inline constexpr size_t cache_line_size = 64;
+
     template<typename T>
     class system_resource : public resource<T>
     {
@@ -47,7 +59,7 @@ namespace zelix::stl::memory
         static T *allocate(Args&&... args) ///< Allocate memory of given size
         {
             void *mem = nullptr;
-            if constexpr (std::is_trivially_constructible_v<T>)
+            if constexpr (uses_malloc_v<T>)
             {
                 mem = static_cast<T *>(malloc(sizeof(T)));
             }
@@ -68,13 +80,17 @@ namespace zelix::stl::memory
 
         static void deallocate(T *ptr) ///< Deallocate memory at given pointer
         {
-            if constexpr (std::is_trivially_destructible_v<T>)
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                ptr->~T(); // Call the destructor
+            }
+
+            if constexpr (uses_malloc_v<T>)
             {
                 free(ptr);
             }
             else
             {
-                ptr->~T(); // Call the destructor
                 operator delete(ptr);
             }
         }
@@ -86,7 +102,7 @@ namespace zelix::stl::memory
     public:
         static T *allocate(size_t n) ///< Allocate memory for the given elements
         {
-            if constexpr (std::is_trivially_constructible_v<T>)
+            if constexpr (uses_malloc_v<T>)
             {
                 return static_cast<T *>(malloc(sizeof(T) * n));
             }
@@ -98,9 +114,10 @@ namespace zelix::stl::memory
 
         static T *reallocate(T *ptr, const size_t old_len, const size_t new_len) ///< Allocate memory for the given elements
         {
-            if constexpr (std::is_trivially_destructible_v<T>)
+            if constexpr (uses_malloc_v<T>)
             {
-                return static_cast<T *>(realloc(ptr, sizeof(T) * new_len));
+                // Cast through void, relocatable types are not trivially copyable
+                return static_cast<T *>(realloc(static_cast<void *>(ptr), sizeof(T) * new_len));
             }
             else
             {
@@ -121,7 +138,7 @@ namespace zelix::stl::memory
 
         static void deallocate(T *ptr) ///< Deallocate memory at given pointer
         {
-            if constexpr (std::is_trivially_destructible_v<T>)
+            if constexpr (uses_malloc_v<T>)
             {
                 free(ptr);
             }
@@ -131,4 +148,55 @@ namespace zelix::stl::memory
             }
         }
     };
-}
\ No newline at end of file
+
+    /**
+     * \brief Array resource whose allocations start on an Alignment boundary.
+     *
+     * By default blocks start on a cache line, so vector loads never split
+     * their first line and neighbouring allocations never share one. Larger
+     * alignments suit buffers handed to the kernel with O_DIRECT, which
+     * requires block-aligned memory.
+     */
+    template <typename T, size_t Alignment = cache_line_size>
+    class aligned_array_resource : public array_resource<T>
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    public:
+        static T *allocate(size_t n) ///< Allocate memory for the given elements
+        {
+            return static_cast<T *>(operator new(sizeof(T) * n, std::align_val_t(Alignment)));
+        }
+
+        static T *reallocate(T *ptr, const size_t old_len, const size_t new_len) ///< Allocate memory for the given elements
+        {
+            T *new_ptr = allocate(new_len);
+            const size_t min_len = min(old_len, new_len);
+
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (min_len != 0) memcpy(new_ptr, ptr, sizeof(T) * min_len);
+            }
+            else
+            {
+                // Move the existing elements to the new memory
+                for (size_t i = 0; i < min_len; ++i)
+                {
+                    new (&new_ptr[i]) T(stl::move(ptr[i]));
+                    ptr[i].~T(); // Call destructor for the moved-from element
+                }
+            }
+
+            deallocate(ptr);
+            return new_ptr;
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            operator delete(ptr, std::align_val_t(Alignment));
+        }
+    };
+
+    template <typename T>
+    using cache_aligned_array_resource = aligned_array_resource<T, cache_line_size>; ///< Array resource aligning every block to a cache line
+}
@@ -0,0 +1,247 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/6/25.
+//
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+#include "resource.h"
+#include "zelix/except/failed_alloc.h"
+#include "zelix/forward.h"
+
+namespace zelix::stl::memory
+{
+    /**
+     * \brief Lock-free concurrent resource with per-thread heaps and remote free lists.
+     *
+     * Every thread allocates from its own heap: a bump pointer into the current
+     * page plus a local free list, neither of which needs synchronization.
+     * Pages are aligned to their size, so the owning heap of any slot is found by
+     * masking its address. A slot freed by a thread that does not own it is pushed
+     * onto the owner's remote free list (a Treiber stack); the owner drains the
+     * whole list with a single exchange once its local list runs dry.
+     *
+     * When a thread exits, its heap is abandoned rather than released, since other
+     * threads may still hold (and free) its slots. The next thread that needs a
+     * heap adopts an abandoned one before creating a new one. Pages are returned
+     * to the system at program exit; objects still alive by then are not destroyed.
+     *
+     * \tparam T Type of the objects to allocate.
+     * \tparam PageSize Minimum size (and alignment) of a page in bytes.
+     */
+    template <typename T, size_t PageSize = 64 * 1024>
+    class thread_cached_resource : public resource<T>
+    {
+        static constexpr size_t slot_align = alignof(T) > alignof(void *) ? alignof(T) : alignof(void *);
+        static constexpr size_t stride =
+            ((sizeof(T) > sizeof(void *) ? sizeof(T) : sizeof(void *)) + slot_align - 1) & ~(slot_align - 1);
+
+        struct heap;
+
+        struct page
+        {
+            heap *owner;
+            page *next;
+        };
+
+        static constexpr size_t header_size = (sizeof(page) + slot_align - 1) & ~(slot_align - 1);
+
+        // Power of two holding at least 16 slots, so the owner is one mask away
+        static constexpr size_t page_size = []
+        {
+            size_t size = 1;
+            while (size < PageSize || size < header_size + 16 * stride)
+                size <<= 1;
+            return size;
+        }();
+
+        struct heap
+        {
+            void *local_free = nullptr; ///< Slots freed by the owning thread
+            std::atomic<void *> remote_free{nullptr}; ///< Slots freed by other threads
+            char *bump = nullptr;
+            char *bump_end = nullptr;
+            page *pages = nullptr;
+            heap *next_abandoned = nullptr;
+            heap *next_heap = nullptr;
+        };
+
+        struct registry
+        {
+            std::mutex mutex;
+            heap *abandoned = nullptr;
+            heap *heaps = nullptr; ///< Every heap ever created, released at exit
+
+            constexpr registry() = default;
+
+            ~registry()
+            {
+                while (heaps)
+                {
+                    heap *h = heaps;
+                    heaps = h->next_heap;
+
+                    while (h->pages)
+                    {
+                        page *p = h->pages;
+                        h->pages = p->next;
+                        ::operator delete(p, std::align_val_t(page_size));
+                    }
+
+                    delete h;
+                }
+            }
+        };
+
+        // Abandons the thread's heap when the thread exits
+        struct thread_guard
+        {
+            ~thread_guard()
+            {
+                if (!current) return;
+
+                std::unique_lock lock(registry_.mutex);
+                current->next_abandoned = registry_.abandoned;
+                registry_.abandoned = current;
+                current = nullptr;
+            }
+        };
+
+        constinit inline static registry registry_;
+        inline static thread_local heap *current = nullptr;
+        inline static thread_local thread_guard guard_;
+
+        static heap *local_heap()
+        {
+            if (current) [[likely]] return current;
+
+            (void) &guard_; // Ensure the guard exists so the heap is abandoned on exit
+            std::unique_lock lock(registry_.mutex);
+            if (registry_.abandoned)
+            {
+                current = registry_.abandoned;
+                registry_.abandoned = current->next_abandoned;
+                current->next_abandoned = nullptr;
+            }
+            else
+            {
+                current = new heap();
+                current->next_heap = registry_.heaps;
+                registry_.heaps = current;
+            }
+
+            return current;
+        }
+
+        static void *&next_of(void *slot)
+        {
+            return *static_cast<void **>(slot);
+        }
+
+        static void *take_slot(heap *h)
+        {
+            void *slot = h->local_free;
+            if (!slot)
+            {
+                // Adopt every remotely freed slot at once
+                slot = h->remote_free.exchange(nullptr, std::memory_order_acquire);
+            }
+
+            if (slot)
+            {
+                h->local_free = next_of(slot);
+                return slot;
+            }
+
+            if (h->bump == h->bump_end)
+            {
+                void *raw = ::operator new(page_size, std::align_val_t(page_size), std::nothrow);
+                if (!raw) throw except::failed_alloc("Out of memory in thread cached resource");
+
+                auto p = static_cast<page *>(raw);
+                p->owner = h;
+                p->next = h->pages;
+                h->pages = p;
+
+                h->bump = static_cast<char *>(raw) + header_size;
+                h->bump_end = h->bump + (page_size - header_size) / stride * stride;
+            }
+
+            slot = h->bump;
+            h->bump += stride;
+            return slot;
+        }
+
+    public:
+        template <typename... Args>
+        static T *allocate(Args&&... args) ///< Allocate memory of given size
+        {
+            heap *h = local_heap();
+            void *slot = take_slot(h);
+
+            try
+            {
+                return new (slot) T(stl::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                next_of(slot) = h->local_free;
+                h->local_free = slot;
+                throw;
+            }
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if (!ptr) return;
+            ptr->~T();
+
+            void *slot = ptr;
+            auto p = reinterpret_cast<page *>(reinterpret_cast<uintptr_t>(slot) & ~(page_size - 1));
+            heap *owner = p->owner;
+
+            if (owner == current)
+            {
+                next_of(slot) = owner->local_free;
+                owner->local_free = slot;
+                return;
+            }
+
+            // Push onto the owner's remote list
+            void *head = owner->remote_free.load(std::memory_order_relaxed);
+            do
+            {
+                next_of(slot) = head;
+            } while (!owner->remote_free.compare_exchange_weak(
+                head, slot, std::memory_order_release, std::memory_order_relaxed));
+        }
+    };
+}
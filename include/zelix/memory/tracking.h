@@ -0,0 +1,397 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "zelix/memory/array_resource.h"
+#include "zelix/memory/resource.h"
+#include "zelix/forward.h"
+#include "zelix/move.h"
+
+namespace zelix::stl::memory
+{
+    /// Whether tracking resources count by default, set with ZELIX_STL_TRACK_ALLOCATIONS
+#   ifdef ZELIX_STL_TRACK_ALLOCATIONS
+    inline constexpr bool tracking_enabled = true;
+#   else
+    inline constexpr bool tracking_enabled = false;
+#   endif
+
+    class allocation_stats;
+    inline std::atomic<allocation_stats *> __tracking_registry{nullptr}; ///< Every stats block created so far, newest first
+
+    /**
+     * \brief Counters kept by one tracked resource.
+     *
+     * All updates are relaxed atomics, so the counters are safe to bump from
+     * several threads but only consistent with each other once they are quiet.
+     * Each block registers itself on construction and lives for the whole
+     * program, dump_allocation_stats() walks all of them.
+     */
+    class allocation_stats
+    {
+        const char *name_;
+        size_t name_len_;
+        allocation_stats *next_ = nullptr;
+
+        void grow(const size_t bytes)
+        {
+            const size_t live = live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            size_t peak = peak_bytes.load(std::memory_order_relaxed);
+            while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+        }
+
+        template <typename Stream>
+        static void field(Stream &out, const char *label, const std::atomic<size_t> &value)
+        {
+            out.write(label, strlen(label));
+            out << static_cast<unsigned long long>(value.load(std::memory_order_relaxed));
+        }
+
+    public:
+        std::atomic<size_t> allocations{0}; ///< Successful allocate() calls
+        std::atomic<size_t> frees{0}; ///< deallocate() calls on non-null pointers
+        std::atomic<size_t> reallocations{0}; ///< reallocate() calls
+        std::atomic<size_t> live_bytes{0}; ///< Bytes currently handed out
+        std::atomic<size_t> peak_bytes{0}; ///< Highest live_bytes seen
+        std::atomic<size_t> total_bytes{0}; ///< Bytes ever handed out, reallocations count their growth
+        std::atomic<size_t> moved_bytes{0}; ///< Bytes copied or moved to a new block by reallocate()
+
+        allocation_stats(const char *name, const size_t name_len) : name_(name), name_len_(name_len)
+        {
+            next_ = __tracking_registry.load(std::memory_order_relaxed);
+            while (!__tracking_registry.compare_exchange_weak(next_, this, std::memory_order_release, std::memory_order_relaxed)) {}
+        }
+
+        allocation_stats(const allocation_stats &) = delete;
+        allocation_stats &operator=(const allocation_stats &) = delete;
+
+        void on_allocate(const size_t bytes)
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            grow(bytes);
+        }
+
+        void on_free(const size_t bytes)
+        {
+            frees.fetch_add(1, std::memory_order_relaxed);
+            live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        void on_reallocate(const size_t old_bytes, const size_t new_bytes, const size_t moved)
+        {
+            reallocations.fetch_add(1, std::memory_order_relaxed);
+            moved_bytes.fetch_add(moved, std::memory_order_relaxed);
+            if (new_bytes > old_bytes)
+            {
+                total_bytes.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed);
+                grow(new_bytes - old_bytes);
+            }
+            else
+            {
+                live_bytes.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+            }
+        }
+
+        /// Zeroes every counter, live_bytes included
+        void reset()
+        {
+            for (auto *counter : {&allocations, &frees, &reallocations, &live_bytes, &peak_bytes, &total_bytes, &moved_bytes})
+            {
+                counter->store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /// Name of the tracked resource type
+        [[nodiscard]] const char *name() const
+        {
+            return name_;
+        }
+
+        [[nodiscard]] size_t name_size() const
+        {
+            return name_len_;
+        }
+
+        [[nodiscard]] allocation_stats *next() const
+        {
+            return next_;
+        }
+
+        /**
+         * \brief Writes the counters as one line to any stream with write() and operator<<.
+         */
+        template <typename Stream>
+        void dump(Stream &out) const
+        {
+            out.write(name_, name_len_);
+            field(out, ": allocations=", allocations);
+            field(out, " frees=", frees);
+            field(out, " reallocations=", reallocations);
+            field(out, " live=", live_bytes);
+            field(out, "B peak=", peak_bytes);
+            field(out, "B total=", total_bytes);
+            field(out, "B moved=", moved_bytes);
+            out.write("B\n", 2);
+        }
+    };
+
+    /**
+     * \brief Writes the counters of every tracked resource used so far, one per line.
+     */
+    template <typename Stream>
+    void dump_allocation_stats(Stream &out)
+    {
+        for (auto *stats = __tracking_registry.load(std::memory_order_acquire); stats; stats = stats->next())
+        {
+            stats->dump(out);
+        }
+    }
+
+    /// Readable name of T, taken from the compiler's signature of this function
+    template <typename T>
+    const char *__tracked_name(size_t &len)
+    {
+#   if defined(__GNUC__) || defined(__clang__)
+        const char *signature = __PRETTY_FUNCTION__;
+        const char *begin = strstr(signature, "T = ");
+        if (!begin)
+        {
+            len = strlen(signature);
+            return signature;
+        }
+
+        begin += 4;
+        const char *end = begin;
+        for (int depth = 0; *end && !(depth == 0 && (*end == ';' || *end == ']')); ++end)
+        {
+            if (*end == '<' || *end == '[' || *end == '(') ++depth;
+            else if (*end == '>' || *end == ']' || *end == ')') --depth;
+        }
+
+        len = static_cast<size_t>(end - begin);
+        return begin;
+#   elif defined(_MSC_VER)
+        len = strlen(__FUNCSIG__);
+        return __FUNCSIG__;
+#   else
+        len = 1;
+        return "?";
+#   endif
+    }
+
+    /// Stats block of one tracked resource type
+    template <typename Inner>
+    allocation_stats &__tracking_stats()
+    {
+        static allocation_stats instance = [] {
+            size_t len;
+            const char *name = __tracked_name<Inner>(len);
+            return allocation_stats(name, len);
+        }();
+        return instance;
+    }
+
+    template <typename F>
+    struct __resource_pointee;
+
+    template <typename T>
+    struct __resource_pointee<void (*)(T *)>
+    {
+        using type = T;
+    };
+
+    /// Element type of a resource, read off its deallocate(T *)
+    template <typename Inner>
+    using __resource_value_t = typename __resource_pointee<decltype(&Inner::deallocate)>::type;
+
+    /**
+     * \brief Object resource that forwards to Inner and counts what passes through.
+     *
+     * Stats are kept per Inner type, see stats(). With Enabled false (the
+     * default unless ZELIX_STL_TRACK_ALLOCATIONS is defined) every call goes
+     * straight to Inner and nothing is counted.
+     *
+     * \tparam Inner The resource doing the actual allocation.
+     * \tparam Enabled Whether to count.
+     */
+    template <typename Inner, bool Enabled = tracking_enabled>
+    class tracking_resource : public resource<__resource_value_t<Inner>>
+    {
+        using T = __resource_value_t<Inner>;
+
+    public:
+        static allocation_stats &stats()
+        {
+            return __tracking_stats<Inner>();
+        }
+
+        template <typename... Args>
+        static T *allocate(Args&&... args) ///< Allocate memory of given size
+        {
+            T *ptr = Inner::allocate(stl::forward<Args>(args)...);
+            if constexpr (Enabled)
+            {
+                if (ptr) stats().on_allocate(sizeof(T));
+            }
+
+            return ptr;
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if constexpr (Enabled)
+            {
+                if (ptr) stats().on_free(sizeof(T));
+            }
+
+            Inner::deallocate(ptr);
+        }
+    };
+
+    /**
+     * \brief Array resource that forwards to Inner and counts what passes through.
+     *
+     * deallocate() is not told the size of the block, so while counting each
+     * block carries its element count in a small header in front of it, taken
+     * from Inner as a few extra elements. Reallocations count the bytes they
+     * move when the block changes address. With Enabled false there is no
+     * header and every call goes straight to Inner.
+     *
+     * \tparam Inner The array resource doing the actual allocation.
+     * \tparam Enabled Whether to count.
+     */
+    template <typename Inner, bool Enabled = tracking_enabled>
+    class tracking_array_resource : public array_resource<__resource_value_t<Inner>>
+    {
+        using T = __resource_value_t<Inner>;
+
+        /// Elements reserved in front of each block for its size, keeps the block aligned for T
+        static constexpr size_t header = (sizeof(size_t) + sizeof(T) - 1) / sizeof(T);
+
+        static size_t stored_size(const T *base)
+        {
+            size_t n;
+            memcpy(&n, base, sizeof(size_t));
+            return n;
+        }
+
+        static void store_size(T *base, const size_t n)
+        {
+            memcpy(static_cast<void *>(base), &n, sizeof(size_t));
+        }
+
+    public:
+        static allocation_stats &stats()
+        {
+            return __tracking_stats<Inner>();
+        }
+
+        static T *allocate(const size_t n) ///< Allocate memory for the given elements
+        {
+            if constexpr (!Enabled)
+            {
+                return Inner::allocate(n);
+            }
+            else
+            {
+                T *base = Inner::allocate(n + header);
+                if (!base) return nullptr;
+
+                store_size(base, n);
+                stats().on_allocate(n * sizeof(T));
+                return base + header;
+            }
+        }
+
+        static T *reallocate(T *ptr, const size_t old_len, const size_t new_len) ///< Allocate memory for the given elements
+        {
+            if constexpr (!Enabled)
+            {
+                return Inner::reallocate(ptr, old_len, new_len);
+            }
+            else
+            {
+                if (!ptr) return allocate(new_len);
+
+                T *base = ptr - header;
+                const size_t old_size = stored_size(base);
+                const size_t kept = old_len < new_len ? old_len : new_len;
+
+                T *new_base;
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    // The header is plain bytes as well, let Inner move it along with the elements
+                    new_base = Inner::reallocate(base, old_len + header, new_len + header);
+                    if (!new_base) return nullptr;
+                }
+                else
+                {
+                    // Inner would run T's move constructor over the header, move the elements by hand
+                    new_base = Inner::allocate(new_len + header);
+                    if (!new_base) return nullptr;
+
+                    for (size_t i = 0; i < kept; ++i)
+                    {
+                        new (&new_base[header + i]) T(stl::move(ptr[i]));
+                        ptr[i].~T();
+                    }
+
+                    Inner::deallocate(base);
+                }
+
+                store_size(new_base, new_len);
+                stats().on_reallocate(old_size * sizeof(T), new_len * sizeof(T), new_base == base ? 0 : kept * sizeof(T));
+                return new_base + header;
+            }
+        }
+
+        static void deallocate(T *ptr) ///< Deallocate memory at given pointer
+        {
+            if constexpr (!Enabled)
+            {
+                Inner::deallocate(ptr);
+            }
+            else
+            {
+                if (!ptr) return;
+
+                T *base = ptr - header;
+                stats().on_free(stored_size(base) * sizeof(T));
+                Inner::deallocate(base);
+            }
+        }
+    };
+}
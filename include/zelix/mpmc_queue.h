@@ -0,0 +1,307 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include "forward.h"
+#include "move.h"
+#include "zelix/memory/system_resource.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        /**
+         * \brief Slot of an mpmc_queue.
+         *
+         * A cell at position p is free for the producer that claims p when
+         * sequence == p, and holds a value for the consumer that claims p when
+         * sequence == p + 1.
+         */
+        template <typename T>
+        struct __mpmc_cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *value()
+            {
+                return reinterpret_cast<T *>(storage);
+            }
+        };
+
+        /**
+         * \brief Bounded multi-producer multi-consumer queue (Vyukov).
+         *
+         * Producers and consumers each claim positions with a CAS on their own
+         * cache line and then synchronize with each other only through the
+         * per-cell sequence number, so pushes and pops never contend on a
+         * shared lock.
+         *
+         * \tparam T       Type of elements stored.
+         * \tparam Max     Capacity of the queue, must be a power of two.
+         * \tparam UseHeap Whether the cells are allocated on the heap or stored inline.
+         */
+        template <
+            typename T,
+            size_t Max,
+            bool UseHeap,
+            typename Allocator = memory::system_array_resource<__mpmc_cell<T>>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<__mpmc_cell<T>>, Allocator>
+            >
+        >
+        class mpmc_queue
+        {
+            static_assert(Max > 1 && (Max & (Max - 1)) == 0, "Queue capacity must be a power of two");
+            static constexpr size_t mask = Max - 1;
+
+            using cell = __mpmc_cell<T>;
+            using data_type = std::conditional_t<
+                UseHeap,
+                cell*,         // heap allocation
+                cell[Max]      // stack allocation
+            >;
+
+            alignas(64) std::atomic<size_t> enqueue_pos_ = 0; ///< Next position producers claim
+            alignas(64) std::atomic<size_t> dequeue_pos_ = 0; ///< Next position consumers claim
+            alignas(64) data_type data;
+
+            static intptr_t distance(const size_t sequence, const size_t pos)
+            {
+                return static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            }
+
+            /**
+             * \brief Claims up to count consecutive positions whose cells are at sequence pos + i + Offset.
+             *
+             * Ready cells stay ready until their claimant touches them, so
+             * positions counted before a successful CAS all belong to the caller.
+             */
+            template <size_t Offset>
+            size_t claim(std::atomic<size_t> &position, size_t &pos, const size_t count)
+            {
+                pos = position.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    size_t n = 0;
+                    while (n < count)
+                    {
+                        const size_t seq = data[(pos + n) & mask].sequence.load(std::memory_order_acquire);
+                        if (distance(seq, pos + n + Offset) != 0) break;
+                        ++n;
+                    }
+
+                    if (n == 0)
+                    {
+                        const size_t seq = data[pos & mask].sequence.load(std::memory_order_acquire);
+                        if (distance(seq, pos + Offset) < 0)
+                        {
+                            return 0; // Full (or empty) for this lap
+                        }
+
+                        // Another thread moved past pos, start over
+                        pos = position.load(std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if (position.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+                    {
+                        return n;
+                    }
+                }
+            }
+
+        public:
+            mpmc_queue()
+            {
+                if constexpr (UseHeap)
+                {
+                    data = Allocator::allocate(Max);
+                    for (size_t i = 0; i < Max; ++i)
+                    {
+                        new (&data[i]) cell;
+                    }
+                }
+
+                for (size_t i = 0; i < Max; ++i)
+                {
+                    data[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            mpmc_queue(const mpmc_queue &) = delete;
+            mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+            /**
+             * \brief Constructs an element at the back of the queue.
+             *
+             * \param args Arguments to forward to T's constructor.
+             * \return false if the queue is full.
+             */
+            template <typename... Args>
+            bool try_emplace(Args&&... args)
+            {
+                size_t pos;
+                if (claim<0>(enqueue_pos_, pos, 1) == 0)
+                {
+                    return false;
+                }
+
+                cell &c = data[pos & mask];
+                new (c.value()) T(stl::forward<Args>(args)...);
+                c.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * \brief Pushes an element to the back of the queue.
+             *
+             * \param value The element to push.
+             * \return false if the queue is full.
+             */
+            template <class U = T>
+            bool try_push(U &&value)
+            {
+                return try_emplace(stl::forward<U>(value));
+            }
+
+            /**
+             * \brief Pushes up to count elements with a single claim.
+             *
+             * \param items Elements to copy into the queue.
+             * \param count Number of elements in items.
+             * \return The number of elements pushed, 0 if the queue is full.
+             */
+            size_t try_push_n(const T *items, const size_t count)
+            {
+                size_t pos;
+                const size_t n = count == 0 ? 0 : claim<0>(enqueue_pos_, pos, count);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    cell &c = data[(pos + i) & mask];
+                    new (c.value()) T(items[i]);
+                    c.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+
+                return n;
+            }
+
+            /**
+             * \brief Pops the element at the front of the queue.
+             *
+             * \param out Receives the popped element.
+             * \return false if the queue is empty.
+             */
+            bool try_pop(T &out)
+            {
+                size_t pos;
+                if (claim<1>(dequeue_pos_, pos, 1) == 0)
+                {
+                    return false;
+                }
+
+                cell &c = data[pos & mask];
+                out = stl::move(*c.value());
+                c.value()->~T();
+                c.sequence.store(pos + Max, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * \brief Pops up to count elements with a single claim.
+             *
+             * \param out Receives the popped elements.
+             * \param count Maximum number of elements to pop.
+             * \return The number of elements popped, 0 if the queue is empty.
+             */
+            size_t try_pop_n(T *out, const size_t count)
+            {
+                size_t pos;
+                const size_t n = count == 0 ? 0 : claim<1>(dequeue_pos_, pos, count);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    cell &c = data[(pos + i) & mask];
+                    out[i] = stl::move(*c.value());
+                    c.value()->~T();
+                    c.sequence.store(pos + i + Max, std::memory_order_release);
+                }
+
+                return n;
+            }
+
+            /// Approximate number of queued elements, may be stale under concurrent use
+            [[nodiscard]] size_t size() const
+            {
+                const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+                const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+                return tail > head ? tail - head : 0;
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return size() == 0;
+            }
+
+            [[nodiscard]] static constexpr size_t capacity()
+            {
+                return Max;
+            }
+
+            ~mpmc_queue()
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    const size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+                    for (size_t i = dequeue_pos_.load(std::memory_order_relaxed); i != tail; ++i)
+                    {
+                        data[i & mask].value()->~T();
+                    }
+                }
+
+                if constexpr (UseHeap)
+                {
+                    for (size_t i = 0; i < Max; ++i)
+                    {
+                        data[i].~cell();
+                    }
+
+                    Allocator::deallocate(data);
+                }
+            }
+        };
+    }
+
+    template <typename T, size_t Max, bool UseHeap>
+    using mpmc_queue = pmr::mpmc_queue<T, Max, UseHeap>;
+}
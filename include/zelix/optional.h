@@ -28,8 +28,11 @@
 //
 
 #pragma once
+#include <new>
+#include <type_traits>
 
 #include "forward.h"
+#include "move.h"
 #include "zelix/except/exception.h"
 
 namespace zelix::stl
@@ -40,7 +43,83 @@ namespace zelix::stl
         alignas(T) unsigned char data_[sizeof(T)]; ///< Storage for the value
         bool has_value = false; ///< Flag to indicate if the optional has a value
 
+        T *value_ptr() noexcept
+        {
+            return reinterpret_cast<T *>(data_);
+        }
+
+        void reset() noexcept
+        {
+            if (has_value)
+            {
+                value_ptr()->~T();
+                has_value = false;
+            }
+        }
+
     public:
+        optional() = default;
+
+        // Trivially copyable values keep optional trivially copyable, so it still returns in registers
+        optional(const optional &) requires std::is_trivially_copy_constructible_v<T> = default;
+        optional(optional &&) requires std::is_trivially_move_constructible_v<T> = default;
+        optional &operator=(const optional &) requires std::is_trivially_copyable_v<T> = default;
+        optional &operator=(optional &&) requires std::is_trivially_copyable_v<T> = default;
+        ~optional() requires std::is_trivially_destructible_v<T> = default;
+
+        optional(const optional &other)
+        {
+            if (other.has_value)
+            {
+                new (data_) T(*reinterpret_cast<const T *>(other.data_));
+                has_value = true;
+            }
+        }
+
+        optional(optional &&other) noexcept
+        {
+            if (other.has_value)
+            {
+                new (data_) T(stl::move(*other.value_ptr()));
+                has_value = true;
+            }
+        }
+
+        optional &operator=(const optional &other)
+        {
+            if (this != &other)
+            {
+                reset();
+                if (other.has_value)
+                {
+                    new (data_) T(*reinterpret_cast<const T *>(other.data_));
+                    has_value = true;
+                }
+            }
+
+            return *this;
+        }
+
+        optional &operator=(optional &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                if (other.has_value)
+                {
+                    new (data_) T(stl::move(*other.value_ptr()));
+                    has_value = true;
+                }
+            }
+
+            return *this;
+        }
+
+        ~optional()
+        {
+            reset();
+        }
+
         static constexpr optional none() noexcept
         {
             return optional(); // Return an empty optional
@@ -49,7 +128,7 @@ namespace zelix::stl
         static constexpr optional some(T val) noexcept
         {
             optional opt; // Create an optional instance
-            new (opt.data_) T(val); // Construct the value in place
+            new (opt.data_) T(stl::move(val)); // Move the by-value argument into place
             opt.has_value = true; // Set the has_value flag
             return opt; // Return the optional with the value
         }
@@ -58,7 +137,7 @@ namespace zelix::stl
         static constexpr optional emplace(Args&&... args)
         {
             optional opt; // Create an optional instance
-            new (opt.data_) T(forward<Args>(args)...); // Direct construction
+            new (opt.data_) T(stl::forward<Args>(args)...); // Direct construction
             opt.has_value = true;
             return opt; // Return the optional with the value
         }
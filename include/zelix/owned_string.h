@@ -28,6 +28,7 @@
 //
 
 #pragma once
+#include <bit>
 #include <cstring>
 #include <xxh3.h>
 #include <functional>
@@ -36,13 +37,20 @@
 #include "zelix/except/out_of_range.h"
 #include "zelix/except/uninitialized_memory.h"
 #include "zelix/memory/system_resource.h"
+#include "zelix/relocatable.h"
 
 namespace zelix::stl
 {
     namespace pmr
     {
         /**
-         * @brief An owned string class.
+         * @brief An owned string class with small-string optimization.
+         *
+         * The object is three words wide. Strings of up to 23 characters (on 64-bit
+         * targets) are kept inline; the last byte then holds the remaining inline
+         * capacity, so it doubles as the null terminator of a full inline string.
+         * Longer strings switch to a heap buffer {pointer, length, capacity}, with
+         * the high bit of the last byte tagging the heap representation.
          *
          * Provides basic push and reserve operations, and exposes a C-style string interface.
          */
@@ -55,54 +63,169 @@ namespace zelix::stl
         >
         class string
         {
-            char* buffer = nullptr; ///< Pointer to heap-allocated string
-            size_t len = 0; ///< Length of the string
-            size_t max_capacity = 0; ///< Maximum capacity of the buffer, -1 for null terminator
-            size_t capacity = 0; ///< Capacity of the string
+            static_assert(sizeof(char *) == sizeof(size_t), "SSO layout expects pointer-sized size_t");
+
+            static constexpr size_t sso_capacity = 3 * sizeof(size_t) - 1; ///< Inline characters, excluding the terminator
+            static constexpr unsigned char heap_tag = 0x80; ///< Set in the last byte for the heap representation
+            static constexpr unsigned char borrowed_tag = 0x01; ///< Heap buffer is not owned (see no_copy)
+            static constexpr size_t tag_shift = std::endian::native == std::endian::little
+                ? (sizeof(size_t) - 1) * 8
+                : 0;
+            static constexpr size_t cap_shift = std::endian::native == std::endian::little ? 0 : 8;
+            static constexpr size_t cap_mask = (~size_t(0) >> 8);
+
+            // Inline: chars[0..22] + remaining count; heap: ptr | len | tagged capacity
+            struct rep
+            {
+                alignas(size_t) unsigned char bytes[sso_capacity + 1];
+            };
+
+            static constexpr rep empty_rep()
+            {
+                rep r{};
+                r.bytes[sso_capacity] = static_cast<unsigned char>(sso_capacity);
+                return r;
+            }
+
+            rep rep_ = empty_rep();
+
+            [[nodiscard]] bool is_heap() const
+            {
+                return rep_.bytes[sso_capacity] & heap_tag;
+            }
+
+            [[nodiscard]] bool owns_heap() const
+            {
+                return (rep_.bytes[sso_capacity] & (heap_tag | borrowed_tag)) == heap_tag;
+            }
+
+            [[nodiscard]] size_t word(const size_t i) const
+            {
+                size_t w;
+                memcpy(&w, rep_.bytes + i * sizeof(size_t), sizeof(size_t));
+                return w;
+            }
+
+            void set_word(const size_t i, const size_t w)
+            {
+                memcpy(rep_.bytes + i * sizeof(size_t), &w, sizeof(size_t));
+            }
+
+            [[nodiscard]] char *data_ptr() const
+            {
+                if (is_heap())
+                {
+                    return reinterpret_cast<char *>(word(0));
+                }
+
+                return reinterpret_cast<char *>(const_cast<unsigned char *>(rep_.bytes));
+            }
+
+            [[nodiscard]] size_t length() const
+            {
+                if (is_heap())
+                {
+                    return word(1);
+                }
+
+                const unsigned char remaining = rep_.bytes[sso_capacity];
+#           if defined(__GNUC__) || defined(__clang__)
+                // Never true in practice, tells the optimizer inline lengths are bounded
+                if (remaining > sso_capacity) __builtin_unreachable();
+#           endif
+                return sso_capacity - remaining;
+            }
+
+            // Characters that fit without growing, excluding the terminator
+            [[nodiscard]] size_t cap() const
+            {
+                return is_heap() ? (word(2) >> cap_shift) & cap_mask : sso_capacity;
+            }
+
+            void set_length(const size_t n)
+            {
+                if (is_heap())
+                {
+                    set_word(1, n);
+                }
+                else
+                {
+                    rep_.bytes[sso_capacity] = static_cast<unsigned char>(sso_capacity - n);
+                }
+            }
+
+            void set_heap(char *ptr, const size_t n, const size_t capacity, const unsigned char flags)
+            {
+                set_word(0, reinterpret_cast<size_t>(ptr));
+                set_word(1, n);
+                set_word(2, (capacity & cap_mask) << cap_shift | static_cast<size_t>(heap_tag | flags) << tag_shift);
+            }
+
+            void reset()
+            {
+                if (owns_heap())
+                {
+                    Allocator::deallocate(data_ptr());
+                }
+
+                rep_ = empty_rep();
+            }
 
             /**
-             * @brief Reallocates the heap buffer to a larger size.
+             * @brief Moves the contents into a heap buffer able to hold new_cap characters.
              *
-             * Copies existing heap data to the new buffer and updates capacity.
+             * Grows an owned heap buffer in place through the allocator, or copies
+             * inline and borrowed contents into a fresh one.
              */
-            void reallocate()
+            void reallocate(const size_t new_cap)
             {
-                capacity = max_capacity + 1;
-                buffer = Allocator::reallocate(buffer, len, capacity);
+                const size_t n = length();
+                if (owns_heap())
+                {
+                    set_heap(Allocator::reallocate(data_ptr(), n, new_cap + 1), n, new_cap, 0);
+                    return;
+                }
+
+                char *buf = Allocator::allocate(new_cap + 1); // +1 for null terminator
+                memcpy(buf, data_ptr(), n);
+                buf[n] = '\0';
+                set_heap(buf, n, new_cap, 0);
             }
 
-            int cmp(const string &other)
+            /// Copies a borrowed buffer (see no_copy) into owned storage before it is written
+            void own()
             {
-                // Handle uninitialized memory
-                if (other.len == 0 || len == 0) return -1;
+                if (is_heap() && !owns_heap())
+                {
+                    reallocate(length());
+                }
+            }
 
-                // Compare
-                const size_t min_len = other->len < len ? other->len : len;
-                const auto res = memcmp(other.buffer, buffer, min_len);
-                if (res == 0)
+            [[nodiscard]] int cmp(const string &other) const
+            {
+                const size_t l = length();
+                const size_t o = other.length();
+                const size_t min_len = o < l ? o : l;
+
+                if (const auto res = memcmp(data_ptr(), other.data_ptr(), min_len); res != 0)
                 {
-                    if (other.len < len) return -1;
-                    if (other.len > len) return 1;
+                    return res;
                 }
 
-                // Return the result directly
-                return res;
+                return l < o ? -1 : l > o ? 1 : 0;
             }
 
         public:
             /**
-             * @brief Default constructor. Initializes an empty string using stack memory.
+             * @brief Default constructor. Initializes an empty inline string.
              */
-            string()
-            {
-                // Do not initialize memory right away
-            }
+            string() = default;
 
             /**
              * @brief Constructs a string with a specified capacity.
              * @param capacity The initial capacity to reserve.
              *
-             * Uses stack memory if capacity is small, otherwise allocates on the heap.
+             * Stays inline if capacity is small, otherwise allocates on the heap.
              */
             explicit string(const size_t capacity)
             {
@@ -114,7 +237,7 @@ namespace zelix::stl
              * @param str Pointer to the character array to copy from.
              * @param s_len The number of characters to copy.
              *
-             * Uses stack memory if the capacity is small enough, otherwise allocates on the heap.
+             * Stays inline if the string is small enough, otherwise allocates on the heap.
              */
             explicit string(const char *str, const size_t s_len)
             {
@@ -126,7 +249,7 @@ namespace zelix::stl
              * @brief Constructs a string from a null-terminated C-style string.
              * @param s Pointer to the null-terminated character array to copy from.
              *
-             * Uses stack memory if the string is small enough, otherwise allocates on the heap.
+             * Stays inline if the string is small enough, otherwise allocates on the heap.
              */
             string(const char *s)
             {
@@ -136,34 +259,43 @@ namespace zelix::stl
             }
 
             string(string &&other) noexcept
-                : buffer(other.buffer), len(other.len), max_capacity(other.max_capacity), capacity(other.capacity)
             {
-                other.buffer = nullptr; // Transfer ownership, set other's heap to nullptr
-                other.len = 0;
-                other.max_capacity = 0;
-                other.capacity = 0;
+                rep_ = other.rep_; // Transfer ownership of the representation
+                other.rep_ = empty_rep();
             }
 
             string(const string& other)
             {
-                if (other.len == 0 || other.buffer == nullptr) return;
-                reserve(other.len);
-                push(other.ptr(), other.len);
+                const size_t n = other.length();
+                reserve(n);
+                push(other.data_ptr(), n);
             }
 
             string& operator=(const string& other)
             {
                 if (this != &other)
                 {
-                    len = 0; // Reset length before pushing new data
-                    if (other.len == 0 || other.buffer == nullptr)
+                    set_length(0); // Reset length before pushing new data
+                    const size_t n = other.length();
+                    if (!owns_heap() && is_heap())
                     {
-                        Allocator::deallocate(buffer);
-                        return *this;
+                        reset(); // Never write into a borrowed buffer
                     }
 
-                    reserve(other.len);
-                    push(other.ptr(), other.len);
+                    reserve(n);
+                    push(other.data_ptr(), n);
+                }
+
+                return *this;
+            }
+
+            string& operator=(string &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    reset();
+                    rep_ = other.rep_;
+                    other.rep_ = empty_rep();
                 }
 
                 return *this;
@@ -173,28 +305,24 @@ namespace zelix::stl
              * @brief Returns a pointer to a null-terminated C-style string.
              * @return Pointer to the string data.
              *
-             * Ensures the string is null-terminated before returning.
+             * Ensures the string is null-terminated before returning. Borrowed
+             * buffers (see no_copy) are copied first since they may not be terminated.
              */
             [[nodiscard]] char *c_str()
             {
-                if (buffer)
-                {
-                    reserve(1); // Ensure space for null terminator
-                    buffer[len] = '\0'; // Ensure null termination for heap memory
-                    return buffer;
-                }
+                own();
 
-                throw except::uninitialized_memory("String not initialized");
+                char *data = data_ptr();
+                data[length()] = '\0'; // Inline strings reuse the remaining-capacity byte when full
+                return data;
             }
 
+            /**
+             * @brief Returns a pointer to the string data (not necessarily null-terminated).
+             */
             [[nodiscard]] char *ptr()
             const {
-                if (!buffer)
-                {
-                    throw except::uninitialized_memory("String not initialized");
-                }
-
-                return buffer; // Return heap memory pointer
+                return data_ptr();
             }
 
             /**
@@ -207,54 +335,43 @@ namespace zelix::stl
             void calibrate(const size_t new_len)
             {
                 // Warning: Only use if you know what you're doing
-                len = new_len;
+                set_length(new_len);
             }
 
             /**
              * @brief Ensures the string has enough capacity for additional data.
              * @param required The additional capacity to reserve.
              *
-             * Switches to heap memory or grows the heap buffer if needed.
+             * Switches to heap memory or grows the heap buffer geometrically if needed.
              */
             void reserve_growth(const size_t required)
             {
-                if (!buffer)
-                {
-                    buffer = Allocator::allocate(required + 1); // +1 for null terminator
-                    capacity = required + 1;
-                    max_capacity = required;
-                    return;
-                }
-
-                if (max_capacity > required + len)
+                const size_t needed = length() + required;
+                const size_t current = cap();
+                if (needed <= current && owns_heap() == is_heap())
                 {
                     return; // Already have enough capacity
                 }
 
-                auto new_capacity = static_cast<size_t>(capacity * GrowthFactor);
-                while (new_capacity < len + required)
+                auto new_capacity = static_cast<size_t>(static_cast<double>(current) * GrowthFactor);
+                while (new_capacity < needed)
                 {
-                    new_capacity = static_cast<size_t>(new_capacity * GrowthFactor); // Increase capacity by growth factor
+                    new_capacity = static_cast<size_t>(static_cast<double>(new_capacity + 1) * GrowthFactor); // Increase capacity by growth factor
                 }
 
-                max_capacity = new_capacity;
-                reallocate();
+                reallocate(new_capacity);
             }
 
+            /**
+             * @brief Ensures the string can hold required more characters without growing.
+             * @param required The additional capacity to reserve.
+             */
             void reserve(const size_t required)
             {
-                if (!buffer)
-                {
-                    buffer = Allocator::allocate(required + 1); // +1 for null terminator
-                    capacity = required + 1;
-                    max_capacity = required;
-                    return;
-                }
-
-                if (len + required > max_capacity)
+                const size_t needed = length() + required;
+                if (needed > cap() || (is_heap() && !owns_heap()))
                 {
-                    max_capacity = len + required;
-                    reallocate();
+                    reallocate(needed > cap() ? needed : cap());
                 }
             }
 
@@ -265,7 +382,11 @@ namespace zelix::stl
             void push(const char c)
             {
                 reserve_growth(1);
-                buffer[len++] = c; // Add character to heap memory
+                const size_t n = length();
+                char *data = data_ptr();
+                data[n] = c;
+                set_length(n + 1);
+                data[n + 1] = '\0'; // Keep owned storage null-terminated
             }
 
             /**
@@ -276,8 +397,11 @@ namespace zelix::stl
             void push(const char *c, const size_t c_len)
             {
                 reserve_growth(c_len);
-                memcpy(buffer + len, c, c_len);
-                len += c_len; // Update the length of the string
+                const size_t n = length();
+                char *data = data_ptr();
+                memmove(data + n, c, c_len);
+                set_length(n + c_len); // Update the length of the string
+                data[n + c_len] = '\0';
             }
 
             void push(const char *c)
@@ -291,38 +415,29 @@ namespace zelix::stl
             string operator+(const string &other) const
             {
                 string result;
-                result.reserve(len + other.len);
-                if (buffer != nullptr)
-                {
-                    result.push(c_str(), len);
-                }
-
-                if (other.buffer != nullptr)
-                {
-                    result.push(other.c_str(), other.len);
-                }
-
+                result.reserve(length() + other.length());
+                result.push(data_ptr(), length());
+                result.push(other.data_ptr(), other.length());
                 return result;
             }
 
             /**
              * @brief Provides non-const access to the character at the specified index.
+             *
+             * Borrowed buffers (see no_copy) are copied first, so writes never
+             * reach the caller's storage.
              * @param index The position of the character to access.
              * @return Reference to the character at the given index.
              */
             char& operator[](const size_t index)
             {
-                if (!buffer)
-                {
-                    throw except::uninitialized_memory("String not initialized");
-                }
-
-                if (index >= len)
+                if (index >= length())
                 {
                     throw except::out_of_range("Index out of range");
                 }
 
-                return buffer[index];
+                own();
+                return data_ptr()[index];
             }
 
             /**
@@ -332,17 +447,12 @@ namespace zelix::stl
              */
             const char& operator[](const size_t index) const
             {
-                if (!buffer)
-                {
-                    throw except::uninitialized_memory("String not initialized");
-                }
-
-                if (index >= len)
+                if (index >= length())
                 {
                     throw except::out_of_range("Index out of range");
                 }
 
-                return buffer[index];
+                return data_ptr()[index];
             }
 
             /**
@@ -353,53 +463,31 @@ namespace zelix::stl
             {
                 const size_t other_len = str::len(other);
                 string result;
-                result.reserve(len + other_len);
-                if (buffer != nullptr)
-                {
-                    result.push(buffer, len);
-                }
-
+                result.reserve(length() + other_len);
+                result.push(data_ptr(), length());
                 result.push(other, other_len);
                 return result;
             }
 
             bool operator==(const string& other) const
             {
-                if (buffer == nullptr && other.buffer == nullptr)
-                {
-                    return true; // Empty strings are equal
-                }
-
-                if (buffer == nullptr || other.buffer == nullptr)
-                {
-                    return false; // One is empty, the other is not
-                }
-
-                if (len != other.len) return false; // Lengths differ, not equal
-                return memcmp(buffer, other.buffer, len) == 0;
+                const size_t n = length();
+                if (n != other.length()) return false; // Lengths differ, not equal
+                return memcmp(data_ptr(), other.data_ptr(), n) == 0;
             }
 
             bool operator==(const external_string& other) const
             {
-                if (buffer == nullptr)
-                {
-                    return false; // The string is empty
-                }
-
-                if (len != other.size()) return false; // Lengths differ, not equal
-                return memcmp(buffer, other.ptr(), len) == 0;
+                const size_t n = length();
+                if (n != other.size()) return false; // Lengths differ, not equal
+                return n == 0 || memcmp(data_ptr(), other.ptr(), n) == 0;
             }
 
             bool operator==(const char *other) const
             {
-                const auto other_len = str::len(other);
-                if (buffer == nullptr && other_len == 0)
-                {
-                    return true; // Both are empty
-                }
-
-                if (len != other_len) return false; // Lengths differ, not equal
-                return memcmp(buffer, other, len) == 0;
+                const size_t n = length();
+                if (n != str::len(other)) return false; // Lengths differ, not equal
+                return memcmp(data_ptr(), other, n) == 0;
             }
 
             /**
@@ -409,67 +497,144 @@ namespace zelix::stl
             [[nodiscard]] size_t size()
             const
             {
-                return len;
+                return length();
             }
 
+            static constexpr size_t npos = str::npos; ///< Returned by find() when nothing matches
+
             /**
-             * @brief Returns a pointer to the beginning of the string buffer.
-             * @return Pointer to the first character of the string.
-             * @throws except::uninitialized_memory if the buffer is not initialized.
+             * @brief Finds the first occurrence of a substring at or after pos.
+             * @param needle Pointer to the characters to look for.
+             * @param pos Index to start searching from.
+             * @param needle_len Number of characters in needle.
+             * @return Index of the match, or npos.
              */
-            [[nodiscard]] const char *begin() const
+            [[nodiscard]] size_t find(const char *needle, const size_t pos, const size_t needle_len) const
             {
-                if (!buffer)
-                {
-                    throw except::uninitialized_memory("String not initialized");
-                }
+                const size_t n = length();
+                if (pos > n) return npos;
+
+                const size_t idx = str::find(data_ptr() + pos, n - pos, needle, needle_len);
+                return idx == npos ? npos : idx + pos;
+            }
+
+            [[nodiscard]] size_t find(const char *needle, const size_t pos = 0) const
+            {
+                return find(needle, pos, str::len(needle));
+            }
 
-                return buffer;
+            [[nodiscard]] size_t find(const string &needle, const size_t pos = 0) const
+            {
+                return find(needle.data_ptr(), pos, needle.length());
+            }
+
+            [[nodiscard]] size_t find(const external_string &needle, const size_t pos = 0) const
+            {
+                return find(needle.ptr(), pos, needle.size());
             }
 
             /**
-             * @brief Returns a pointer to one past the last character of the string buffer.
-             * @return Pointer to the end of the string (buffer + len).
-             * @throws except::uninitialized_memory if the buffer is not initialized.
+             * @brief Finds the first occurrence of a character at or after pos.
+             * @return Index of the match, or npos.
              */
-            [[nodiscard]] const char *end() const
+            [[nodiscard]] size_t find(const char c, const size_t pos = 0) const
+            {
+                const size_t n = length();
+                if (pos > n) return npos;
+
+                const size_t idx = str::find_char(data_ptr() + pos, n - pos, c);
+                return idx == npos ? npos : idx + pos;
+            }
+
+            /**
+             * @brief Checks whether the string starts with the given characters.
+             */
+            [[nodiscard]] bool starts_with(const char *prefix, const size_t prefix_len) const
             {
-                if (!buffer)
+                return str::starts_with(data_ptr(), length(), prefix, prefix_len);
+            }
+
+            [[nodiscard]] bool starts_with(const char *prefix) const
+            {
+                return starts_with(prefix, str::len(prefix));
+            }
+
+            [[nodiscard]] bool starts_with(const string &prefix) const
+            {
+                return starts_with(prefix.data_ptr(), prefix.length());
+            }
+
+            /**
+             * @brief Checks whether the string ends with the given characters.
+             */
+            [[nodiscard]] bool ends_with(const char *suffix, const size_t suffix_len) const
+            {
+                return str::ends_with(data_ptr(), length(), suffix, suffix_len);
+            }
+
+            [[nodiscard]] bool ends_with(const char *suffix) const
+            {
+                return ends_with(suffix, str::len(suffix));
+            }
+
+            [[nodiscard]] bool ends_with(const string &suffix) const
+            {
+                return ends_with(suffix.data_ptr(), suffix.length());
+            }
+
+            /**
+             * @brief Checks whether the string contains the given characters.
+             */
+            [[nodiscard]] bool contains(const char *needle) const
+            {
+                return find(needle) != npos;
+            }
+
+            /**
+             * @brief Counts the occurrences of a character.
+             */
+            [[nodiscard]] size_t count(const char c) const
+            {
+                return str::count_char(data_ptr(), length(), c);
+            }
+
+            /**
+             * @brief Lowercases ASCII letters in place; other bytes are left untouched.
+             */
+            void to_lower()
+            {
+                if (is_heap() && !owns_heap())
                 {
-                    throw except::uninitialized_memory("String not initialized");
+                    reallocate(length()); // Borrowed buffers are copied before being written to
                 }
 
-                return buffer + len;
+                str::to_lower_ascii(data_ptr(), data_ptr(), length());
+            }
+
+            /**
+             * @brief Returns whether the string holds its characters inline.
+             */
+            [[nodiscard]] bool is_inline() const
+            {
+                return !is_heap();
             }
 
             /**
              * @brief Returns a pointer to the beginning of the string buffer.
              * @return Pointer to the first character of the string.
-             * @throws except::uninitialized_memory if the buffer is not initialized.
              */
-            [[nodiscard]] const char *begin()
+            [[nodiscard]] const char *begin() const
             {
-                if (!buffer)
-                {
-                    throw except::uninitialized_memory("String not initialized");
-                }
-
-                return buffer;
+                return data_ptr();
             }
 
             /**
              * @brief Returns a pointer to one past the last character of the string buffer.
              * @return Pointer to the end of the string (buffer + len).
-             * @throws except::uninitialized_memory if the buffer is not initialized.
              */
-            [[nodiscard]] const char *end()
+            [[nodiscard]] const char *end() const
             {
-                if (!buffer)
-                {
-                    throw except::uninitialized_memory("String not initialized");
-                }
-
-                return buffer + len;
+                return data_ptr() + length();
             }
 
             /**
@@ -479,26 +644,27 @@ namespace zelix::stl
              */
             void clear()
             {
-                len = 0;
+                set_length(0);
             }
 
             external_string external()
             {
-                return { buffer, len };
+                if (length() == 0) return {};
+                return { data_ptr(), length() };
             }
 
             /**
              * @brief Creates a string object that uses an external buffer without copying.
              *
-             * The returned string will directly reference the provided buffer.
+             * The returned string will directly reference the provided buffer and never
+             * frees it; the first mutation (or c_str()) copies it into owned storage.
              * The caller is responsible for ensuring the buffer remains valid for the lifetime of the string.
-             * No memory is allocated or copied.
              *
              * @param buf Pointer to the external character buffer.
              * @param buf_len Length of the buffer.
              * @return string referencing the external buffer.
              */
-            static string no_copy(char *buf, const size_t buf_len)
+            static string no_copy(const char *buf, const size_t buf_len)
             {
                 string result;
 
@@ -507,10 +673,7 @@ namespace zelix::stl
                     return result; // Return empty string if buffer length is zero
                 }
 
-                result.buffer = buf;
-                result.len = buf_len;
-                result.capacity = buf_len; // +1 for null terminator
-                result.max_capacity = buf_len - 1;
+                result.set_heap(const_cast<char *>(buf), buf_len, buf_len, borrowed_tag);
                 return result;
             }
 
@@ -535,19 +698,22 @@ namespace zelix::stl
             }
 
             /**
-             * @brief Destructor. Releases heap memory if allocated.
+             * @brief Destructor. Releases heap memory if owned.
              */
             ~string()
             {
-                if (buffer)
+                if (owns_heap())
                 {
-                    Allocator::deallocate(buffer);
-                    buffer = nullptr;
+                    Allocator::deallocate(data_ptr());
                 }
             }
         };
     }
 
+    /// Only the inline buffer lives in the object and it is addressed relative to this
+    template <double GrowthFactor, typename Allocator, typename E>
+    struct is_trivially_relocatable<pmr::string<GrowthFactor, Allocator, E>> : std::true_type {};
+
     using string = pmr::string<>;
 
     struct string_hash
@@ -569,7 +735,7 @@ namespace zelix::stl
         size_t operator()(const char* c_str) const
         {
             const size_t len = str::len(c_str);
-            return XXH64(c_str, len, len);
+            return XXH3_64bits(c_str, len); // Must agree with the string overload for heterogeneous lookup
         }
     };
 }
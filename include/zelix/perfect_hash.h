@@ -0,0 +1,290 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+#include "external_string.h"
+#include "string_equality.h"
+#include "string_utils.h"
+
+namespace zelix::stl
+{
+    /// 64-bit string hash usable in constant expressions; the byte assembly folds into plain loads at runtime
+    constexpr uint64_t __chd_hash(const char *s, const size_t n, const uint64_t seed)
+    {
+        uint64_t h = seed ^ (0x9E3779B97F4A7C15ull * (n + 1));
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            uint64_t word = 0;
+            for (size_t b = 0; b < 8; ++b)
+            {
+                word |= static_cast<uint64_t>(static_cast<unsigned char>(s[i + b])) << (8 * b);
+            }
+
+            h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+            h ^= h >> 32;
+        }
+
+        uint64_t tail = 0;
+        for (size_t b = 0; i + b < n; ++b)
+        {
+            tail |= static_cast<uint64_t>(static_cast<unsigned char>(s[i + b])) << (8 * b);
+        }
+
+        h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 29;
+        h *= 0x9E3779B97F4A7C15ull;
+        h ^= h >> 32;
+        return h;
+    }
+
+    /**
+     * @brief Output of the CHD builder: per-bucket displacements and the key owning each slot.
+     *
+     * A key with hash h lands in bucket (h >> 40) % Buckets and then at slot
+     * (f1 + d0 * f2 + d1) % Keys, with f1 and f2 derived from h and (d0, d1)
+     * the bucket's displacement pair.
+     */
+    template <size_t Keys, size_t Buckets>
+    struct __chd_table
+    {
+        uint64_t seed = 0;
+        uint32_t displacement[Buckets][2] = {};
+        uint32_t slot_key[Keys] = {}; ///< Index into the key list of the key stored at each slot
+
+        [[nodiscard]] static constexpr size_t bucket(const uint64_t h)
+        {
+            return static_cast<size_t>((h >> 40) % Buckets);
+        }
+
+        [[nodiscard]] static constexpr size_t slot(const uint64_t h, const uint32_t d0, const uint32_t d1)
+        {
+            const uint64_t f1 = static_cast<uint32_t>(h) % Keys;
+            const uint64_t f2 = Keys > 1 ? static_cast<uint32_t>(h >> 20) % (Keys - 1) + 1 : 0;
+            return static_cast<size_t>((f1 + d0 * f2 + d1) % Keys);
+        }
+
+        [[nodiscard]] constexpr size_t slot(const uint64_t h) const
+        {
+            const auto &d = displacement[bucket(h)];
+            return slot(h, d[0], d[1]);
+        }
+    };
+
+    /// Four keys per bucket on average keeps displacement searches short
+    template <size_t Keys>
+    inline constexpr size_t __chd_buckets = Keys / 4 + 1;
+
+    /**
+     * @brief Builds a minimal perfect hash over the given keys (CHD).
+     *
+     * Buckets are placed largest first, searching displacement pairs until
+     * every key of the bucket falls on a free slot; single-key buckets go
+     * straight to the next free slot. If two keys cannot be separated under
+     * a seed the whole build restarts with the next seed.
+     */
+    template <size_t N>
+    consteval __chd_table<N, __chd_buckets<N>> __chd_build(const external_string (&keys)[N])
+    {
+        constexpr size_t buckets = __chd_buckets<N>;
+        using table_type = __chd_table<N, buckets>;
+
+        // No seed can separate equal keys, so reject them before searching
+        for (size_t i = 0; i < N; ++i)
+        {
+            if (keys[i].size() == 0) throw except::exception("Perfect hash keys cannot be empty");
+
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (keys[j].size() != keys[i].size()) continue;
+
+                size_t k = 0;
+                while (k < keys[i].size() && keys[j].ptr()[k] == keys[i].ptr()[k]) ++k;
+                if (k == keys[i].size()) throw except::exception("Perfect hash keys must be distinct");
+            }
+        }
+
+        for (uint64_t seed = 0; ; ++seed)
+        {
+            table_type table{};
+            table.seed = seed;
+
+            uint64_t hash[N] = {};
+            size_t bucket_size[buckets] = {};
+            for (size_t i = 0; i < N; ++i)
+            {
+                hash[i] = __chd_hash(keys[i].ptr(), keys[i].size(), seed);
+                ++bucket_size[table_type::bucket(hash[i])];
+            }
+
+            // Bucket indices ordered by size, largest first
+            size_t order[buckets] = {};
+            for (size_t b = 0; b < buckets; ++b)
+            {
+                size_t j = b;
+                while (j > 0 && bucket_size[order[j - 1]] < bucket_size[b])
+                {
+                    order[j] = order[j - 1];
+                    --j;
+                }
+
+                order[j] = b;
+            }
+
+            bool taken[N] = {};
+            size_t slots[N] = {};
+            bool placed_all = true;
+
+            for (size_t o = 0; o < buckets && placed_all; ++o)
+            {
+                const size_t b = order[o];
+                if (bucket_size[b] == 0) break; // Only empty buckets remain
+
+                size_t members[N] = {};
+                size_t count = 0;
+                for (size_t i = 0; i < N; ++i)
+                {
+                    if (table_type::bucket(hash[i]) == b) members[count++] = i;
+                }
+
+                if (count == 1)
+                {
+                    // Reach any free slot directly through d1
+                    size_t free = 0;
+                    while (taken[free]) ++free;
+
+                    const size_t base = table_type::slot(hash[members[0]], 0, 0);
+                    table.displacement[b][0] = 0;
+                    table.displacement[b][1] = static_cast<uint32_t>((free + N - base) % N);
+                    taken[free] = true;
+                    table.slot_key[free] = static_cast<uint32_t>(members[0]);
+                    continue;
+                }
+
+                bool placed = false;
+                for (uint32_t d0 = 0; d0 < N && !placed; ++d0)
+                {
+                    for (uint32_t d1 = 0; d1 < N && !placed; ++d1)
+                    {
+                        size_t k = 0;
+                        for (; k < count; ++k)
+                        {
+                            slots[k] = table_type::slot(hash[members[k]], d0, d1);
+                            if (taken[slots[k]]) break;
+
+                            bool clash = false;
+                            for (size_t j = 0; j < k && !clash; ++j) clash = slots[j] == slots[k];
+                            if (clash) break;
+                        }
+
+                        if (k != count) continue;
+
+                        for (k = 0; k < count; ++k)
+                        {
+                            taken[slots[k]] = true;
+                            table.slot_key[slots[k]] = static_cast<uint32_t>(members[k]);
+                        }
+
+                        table.displacement[b][0] = d0;
+                        table.displacement[b][1] = d1;
+                        placed = true;
+                    }
+                }
+
+                placed_all = placed;
+            }
+
+            if (placed_all) return table;
+        }
+    }
+
+    /**
+     * @brief Compile-time minimal perfect hash over a fixed set of strings.
+     *
+     * The table is built entirely during compilation; a lookup is one hash,
+     * one table read and one string_equal against the candidate key.
+     *
+     * Usage:
+     * \code
+     * static constexpr external_string keywords[] = {
+     *     external_string::literal("if"), external_string::literal("else")
+     * };
+     * const size_t kind = perfect_hash<keywords>::find(word.ptr(), word.size());
+     * \endcode
+     *
+     * @tparam Keys A constexpr array of distinct, non-empty external_string with static storage duration.
+     */
+    template <const auto &Keys>
+    class perfect_hash
+    {
+        static constexpr size_t count = std::extent_v<std::remove_reference_t<decltype(Keys)>>;
+        static_assert(count > 0, "perfect_hash needs at least one key");
+
+        static constexpr auto table = __chd_build(Keys);
+
+    public:
+        static constexpr size_t npos = str::npos;
+
+        /**
+         * @brief Finds a key.
+         *
+         * @return The key's index in Keys, or npos when it is not in the set.
+         */
+        [[nodiscard]] static size_t find(const char *s, const size_t n)
+        {
+            if (n == 0) return npos;
+
+            const size_t idx = table.slot_key[table.slot(__chd_hash(s, n, table.seed))];
+            return string_equal{}(external_string(s, n), Keys[idx]) ? idx : npos;
+        }
+
+        [[nodiscard]] static size_t find(const external_string &s)
+        {
+            return find(s.ptr(), s.size());
+        }
+
+        [[nodiscard]] static bool contains(const char *s, const size_t n)
+        {
+            return find(s, n) != npos;
+        }
+
+        [[nodiscard]] static bool contains(const external_string &s)
+        {
+            return find(s.ptr(), s.size()) != npos;
+        }
+
+        [[nodiscard]] static constexpr size_t size()
+        {
+            return count;
+        }
+    };
+}
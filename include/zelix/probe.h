@@ -0,0 +1,65 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+
+// Probes in the containers' hot paths. Without ZELIX_STL_INSTRUMENT every
+// macro expands to nothing; with it, each probe bumps a named counter from
+// instrument.h, and with ZELIX_STL_USDT also fires a USDT tracepoint under
+// the zelix_stl provider (readable with perf, bpftrace or SystemTap)
+#if defined(ZELIX_STL_INSTRUMENT)
+#   include "zelix/instrument.h"
+#   if defined(ZELIX_STL_USDT) && defined(__has_include) && __has_include(<sys/sdt.h>)
+#       include <sys/sdt.h>
+#       define ZELIX_STL_USDT_PROBE1(name, value) STAP_PROBE1(zelix_stl, name, value);
+#   else
+#       define ZELIX_STL_USDT_PROBE1(name, value)
+#   endif
+
+    /// Counts one hit of the probe called name and adds value to its total
+#   define ZELIX_STL_PROBE1(name, value) \
+        do \
+        { \
+            static ::zelix::stl::instrument::counter __zelix_probe_##name(#name); \
+            const auto __zelix_probe_value = static_cast<uint64_t>(value); \
+            __zelix_probe_##name.add(__zelix_probe_value); \
+            ZELIX_STL_USDT_PROBE1(name, __zelix_probe_value) \
+        } while (0)
+
+    /// Times the rest of the enclosing scope into the histogram called name
+#   define ZELIX_STL_SCOPED_TIMER(name) \
+        static ::zelix::stl::instrument::histogram __zelix_timer_hist_##name(#name); \
+        const ::zelix::stl::instrument::scoped_timer __zelix_timer_##name(__zelix_timer_hist_##name)
+#else
+#   define ZELIX_STL_PROBE1(name, value) ((void) 0)
+#   define ZELIX_STL_SCOPED_TIMER(name) static_assert(true)
+#endif
+
+/// Counts one hit of the probe called name
+#define ZELIX_STL_PROBE(name) ZELIX_STL_PROBE1(name, 1)
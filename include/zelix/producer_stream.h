@@ -0,0 +1,259 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <type_traits>
+
+#include "move.h"
+#include "optional.h"
+#include "generator.h"
+#include "zelix/except/out_of_range.h"
+#include "zelix/memory/system_resource.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        /**
+         * @brief Stream that pulls its elements lazily from a producer.
+         *
+         * Elements are fetched in chunks into a ring holding the last Window
+         * consumed elements plus up to Lookahead pending ones; slots older than
+         * the window are recycled for new chunks, so memory stays bounded no
+         * matter how long the input is. set_pos may only move back within the
+         * window. References returned by the *_ref accessors stay valid until
+         * their element falls out of the window.
+         *
+         * The producer is any callable size_t(T *out, size_t max) that writes
+         * up to max elements and returns how many it wrote, 0 once exhausted,
+         * for example a generator<T>.
+         *
+         * @tparam T Type of the elements, must be default constructible.
+         * @tparam Producer Source of elements.
+         * @tparam Window Number of consumed elements kept for backtracking.
+         * @tparam Lookahead Maximum peek distance, also the refill chunk size.
+         */
+        template <
+            typename T,
+            typename Producer = generator<T>,
+            size_t Window = 64,
+            size_t Lookahead = 64,
+            typename Allocator = memory::system_array_resource<T>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<T>, Allocator>
+            >
+        >
+        class producer_stream
+        {
+            static_assert(Lookahead > 0, "Lookahead must be at least 1");
+            static_assert(std::is_default_constructible_v<T>, "Ring slots are default constructed");
+
+            /// Ring size: a power of two holding the window and a full lookahead
+            static constexpr size_t capacity = [] {
+                size_t c = 1;
+                while (c < Window + Lookahead) c <<= 1;
+                return c;
+            }();
+            static constexpr size_t mask = capacity - 1;
+
+            Producer producer_;
+            T *ring_;
+            size_t pos_ = 0; ///< Absolute index of the next element
+            size_t filled_ = 0; ///< Absolute index one past the last produced element
+            size_t low_ = 0; ///< Oldest absolute index still retained, never decreases
+            bool exhausted_ = false;
+            optional<T> sentinel_;
+
+            /// Pulls chunks until the element at absolute index is available or the producer runs dry
+            bool ensure(const size_t index)
+            {
+                while (index >= filled_)
+                {
+                    if (exhausted_) return false;
+
+                    // Recycle what fell out of the window
+                    if (pos_ > Window + low_) low_ = pos_ - Window;
+
+                    const size_t free = capacity - (filled_ - low_);
+                    const size_t contiguous = capacity - (filled_ & mask);
+                    size_t count = free < contiguous ? free : contiguous;
+                    if (count > Lookahead) count = Lookahead;
+
+                    const size_t got = producer_(ring_ + (filled_ & mask), count);
+                    if (got == 0) exhausted_ = true;
+                    filled_ += got;
+                }
+
+                return true;
+            }
+
+            T &at(const size_t index)
+            {
+                return ring_[index & mask];
+            }
+
+            const T &end_element()
+            {
+                return sentinel_.get();
+            }
+
+            void init()
+            {
+                ring_ = Allocator::allocate(capacity);
+                for (size_t i = 0; i < capacity; ++i)
+                {
+                    new (&ring_[i]) T();
+                }
+            }
+
+        public:
+            explicit producer_stream(Producer producer)
+                : producer_(stl::move(producer)), sentinel_(optional<T>::emplace())
+            {
+                init();
+            }
+
+            /**
+             * @brief Constructs a stream whose *_ref accessors return sentinel past the end.
+             */
+            producer_stream(Producer producer, T sentinel)
+                : producer_(stl::move(producer)), sentinel_(optional<T>::some(stl::move(sentinel)))
+            {
+                init();
+            }
+
+            producer_stream(const producer_stream &) = delete;
+            producer_stream &operator=(const producer_stream &) = delete;
+
+            optional<T> peek(const size_t n)
+            {
+                if (n >= Lookahead) throw except::out_of_range("Peek distance exceeds the lookahead");
+                if (!ensure(pos_ + n)) return optional<T>::none();
+                return optional<T>::emplace(at(pos_ + n));
+            }
+
+            optional<T> peek()
+            {
+                return peek(0);
+            }
+
+            optional<T> curr()
+            {
+                if (pos_ == 0 || pos_ > filled_) return optional<T>::none();
+                return optional<T>::emplace(at(pos_ - 1));
+            }
+
+            optional<T> next()
+            {
+                if (!ensure(pos_)) return optional<T>::none();
+                return optional<T>::emplace(at(pos_++));
+            }
+
+            /**
+             * @brief Returns the element n positions ahead without copying it.
+             *
+             * @return The element, or the sentinel past the end.
+             * @throws except::out_of_range If n is not below Lookahead.
+             */
+            const T &peek_ref(const size_t n = 0)
+            {
+                if (n >= Lookahead) throw except::out_of_range("Peek distance exceeds the lookahead");
+                return ensure(pos_ + n) ? at(pos_ + n) : end_element();
+            }
+
+            /**
+             * @brief Returns the last consumed element, or the sentinel if nothing was consumed yet.
+             */
+            const T &curr_ref()
+            {
+                return pos_ == 0 ? end_element() : at(pos_ - 1);
+            }
+
+            /**
+             * @brief Returns the next element without copying it and advances past it.
+             *
+             * @return The element, or the sentinel (without advancing) at the end.
+             */
+            const T &next_ref()
+            {
+                return ensure(pos_) ? at(pos_++) : end_element();
+            }
+
+            /**
+             * @brief Whether ref is the end-of-stream sentinel returned by the *_ref accessors.
+             */
+            [[nodiscard]] bool is_end(const T &ref) const
+            {
+                return &ref == &sentinel_.get();
+            }
+
+            /**
+             * @brief Whether every element has been consumed, pulling a chunk if needed to find out.
+             */
+            [[nodiscard]] bool at_end()
+            {
+                return !ensure(pos_);
+            }
+
+            [[nodiscard]] size_t pos() const
+            {
+                return pos_;
+            }
+
+            /**
+             * @brief Moves to an absolute position within the backtrack window.
+             *
+             * @throws except::out_of_range If pos has been recycled or was never produced.
+             */
+            void set_pos(const size_t pos)
+            {
+                const size_t oldest = pos_ > Window + low_ ? pos_ - Window : low_;
+                if (pos < oldest || pos > filled_)
+                {
+                    throw except::out_of_range("Position outside the backtrack window");
+                }
+
+                pos_ = pos;
+            }
+
+            ~producer_stream()
+            {
+                for (size_t i = 0; i < capacity; ++i)
+                {
+                    ring_[i].~T();
+                }
+
+                Allocator::deallocate(ring_);
+            }
+        };
+    }
+
+    template <typename T, typename Producer = generator<T>, size_t Window = 64, size_t Lookahead = 64>
+    using producer_stream = pmr::producer_stream<T, Producer, Window, Lookahead>;
+}
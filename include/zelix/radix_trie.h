@@ -0,0 +1,735 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "memory/array_resource.h"
+#include "memory/monotonic.h"
+#include "memory/system_resource.h"
+#include "owned_string.h"
+#include "string_utils.h"
+#include "vector.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        enum class __art_kind : uint8_t
+        {
+            leaf,
+            node4,
+            node16,
+            node48,
+            node256
+        };
+
+        /// Number of compressed prefix bytes kept in a node, longer prefixes are checked against a leaf
+        inline constexpr uint32_t __art_max_prefix = 10;
+
+        struct __art_base
+        {
+            __art_kind kind;
+
+            explicit __art_base(const __art_kind k)
+                : kind(k)
+            {}
+        };
+
+        struct __art_leaf : __art_base
+        {
+            uint32_t len;
+            char *key; ///< Full key, owned through the trie's KeyAllocator
+
+            __art_leaf(char *k, const uint32_t n)
+                : __art_base(__art_kind::leaf), len(n), key(k)
+            {}
+
+            [[nodiscard]] bool matches(const char *word, const size_t n) const
+            {
+                return len == n && (n == 0 || memcmp(key, word, n) == 0);
+            }
+        };
+
+        struct __art_node : __art_base
+        {
+            uint16_t count = 0; ///< Number of children
+            uint32_t prefix_len = 0; ///< Length of the compressed path above the children
+            unsigned char prefix[__art_max_prefix] = {}; ///< First bytes of the compressed path
+            __art_leaf *terminal = nullptr; ///< Key ending exactly at this node, if any
+
+            explicit __art_node(const __art_kind k)
+                : __art_base(k)
+            {}
+
+            /// Copies the header of another node being grown into this one
+            void take_header(const __art_node &other)
+            {
+                count = other.count;
+                prefix_len = other.prefix_len;
+                memcpy(prefix, other.prefix, __art_max_prefix);
+                terminal = other.terminal;
+            }
+        };
+
+        struct __art_node4 : __art_node
+        {
+            unsigned char keys[4] = {}; ///< Sorted key bytes
+            __art_base *children[4] = {};
+
+            __art_node4()
+                : __art_node(__art_kind::node4)
+            {}
+        };
+
+        struct __art_node16 : __art_node
+        {
+            alignas(16) char keys[16] = {}; ///< Sorted key bytes, scanned with a single vector compare
+            __art_base *children[16] = {};
+
+            __art_node16()
+                : __art_node(__art_kind::node16)
+            {}
+        };
+
+        struct __art_node48 : __art_node
+        {
+            unsigned char index[256] = {}; ///< Slot + 1 of the child for each byte, 0 if absent
+            __art_base *children[48] = {};
+
+            __art_node48()
+                : __art_node(__art_kind::node48)
+            {}
+        };
+
+        struct __art_node256 : __art_node
+        {
+            __art_base *children[256] = {};
+
+            __art_node256()
+                : __art_node(__art_kind::node256)
+            {}
+        };
+
+        /**
+         * @brief Adaptive radix tree over arbitrary byte strings.
+         *
+         * Inner nodes grow through four layouts (4, 16, 48 and 256 children)
+         * as they fill, and chains of single-child nodes are collapsed into a
+         * prefix stored in the node below them. Node16 lookups compare all
+         * keys at once using the string_utils kernels. Keys are stored whole in
+         * their leaves, which makes enumeration cheap and lets long prefixes
+         * be checked optimistically.
+         *
+         * @tparam NodeResource Resource template used for every node type.
+         * @tparam KeyAllocator Allocator for the key bytes held by leaves.
+         */
+        template <
+            template <typename> class NodeResource = memory::monotonic_resource,
+            typename KeyAllocator = memory::system_array_resource<char>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<char>, KeyAllocator>
+            >
+        >
+        class radix_trie
+        {
+            using leaf = __art_leaf;
+            using node = __art_node;
+            using node4 = __art_node4;
+            using node16 = __art_node16;
+            using node48 = __art_node48;
+            using node256 = __art_node256;
+
+            __art_base *root = nullptr;
+            size_t len = 0;
+
+            static unsigned char byte_at(const char *word, const size_t i)
+            {
+                return static_cast<unsigned char>(word[i]);
+            }
+
+            static leaf *make_leaf(const char *word, const size_t n)
+            {
+                char *key = nullptr;
+                if (n != 0)
+                {
+                    key = KeyAllocator::allocate(n);
+                    memcpy(key, word, n);
+                }
+
+                return NodeResource<leaf>::allocate(key, static_cast<uint32_t>(n));
+            }
+
+            /// Returns the slot holding the child for byte c, or nullptr
+            static __art_base **find_child(node *n, const unsigned char c)
+            {
+                switch (n->kind)
+                {
+                    case __art_kind::node4:
+                    {
+                        auto *n4 = static_cast<node4 *>(n);
+                        for (uint16_t i = 0; i < n4->count; ++i)
+                        {
+                            if (n4->keys[i] == c) return &n4->children[i];
+                        }
+
+                        return nullptr;
+                    }
+                    case __art_kind::node16:
+                    {
+                        // Unused keys sit past count, so the first match is valid iff it is below count
+                        auto *n16 = static_cast<node16 *>(n);
+                        const size_t i = str::find_char(n16->keys, 16, static_cast<char>(c));
+                        return i < n16->count ? &n16->children[i] : nullptr;
+                    }
+                    case __art_kind::node48:
+                    {
+                        auto *n48 = static_cast<node48 *>(n);
+                        const unsigned char slot = n48->index[c];
+                        return slot ? &n48->children[slot - 1] : nullptr;
+                    }
+                    case __art_kind::node256:
+                    {
+                        auto *n256 = static_cast<node256 *>(n);
+                        return n256->children[c] ? &n256->children[c] : nullptr;
+                    }
+                    default:
+                        return nullptr;
+                }
+            }
+
+            /// Inserts into a sorted key array of a node4/node16 with room left
+            template <typename Key>
+            static void insert_sorted(Key *keys, __art_base **children, const uint16_t count, const unsigned char c, __art_base *child)
+            {
+                uint16_t i = 0;
+                while (i < count && static_cast<unsigned char>(keys[i]) < c) ++i;
+
+                memmove(keys + i + 1, keys + i, (count - i) * sizeof(Key));
+                memmove(children + i + 1, children + i, (count - i) * sizeof(__art_base *));
+                keys[i] = static_cast<Key>(c);
+                children[i] = child;
+            }
+
+            /// Adds a child for byte c, growing the node (and updating ref) when it is full
+            static void add_child(__art_base **ref, node *n, const unsigned char c, __art_base *child)
+            {
+                switch (n->kind)
+                {
+                    case __art_kind::node4:
+                    {
+                        auto *n4 = static_cast<node4 *>(n);
+                        if (n4->count < 4)
+                        {
+                            insert_sorted(n4->keys, n4->children, n4->count, c, child);
+                            ++n4->count;
+                            return;
+                        }
+
+                        auto *grown = NodeResource<node16>::allocate();
+                        grown->take_header(*n4);
+                        for (uint16_t i = 0; i < 4; ++i)
+                        {
+                            grown->keys[i] = static_cast<char>(n4->keys[i]);
+                            grown->children[i] = n4->children[i];
+                        }
+
+                        NodeResource<node4>::deallocate(n4);
+                        *ref = grown;
+                        add_child(ref, grown, c, child);
+                        return;
+                    }
+                    case __art_kind::node16:
+                    {
+                        auto *n16 = static_cast<node16 *>(n);
+                        if (n16->count < 16)
+                        {
+                            insert_sorted(n16->keys, n16->children, n16->count, c, child);
+                            ++n16->count;
+                            return;
+                        }
+
+                        auto *grown = NodeResource<node48>::allocate();
+                        grown->take_header(*n16);
+                        for (uint16_t i = 0; i < 16; ++i)
+                        {
+                            grown->index[static_cast<unsigned char>(n16->keys[i])] = static_cast<unsigned char>(i + 1);
+                            grown->children[i] = n16->children[i];
+                        }
+
+                        NodeResource<node16>::deallocate(n16);
+                        *ref = grown;
+                        add_child(ref, grown, c, child);
+                        return;
+                    }
+                    case __art_kind::node48:
+                    {
+                        auto *n48 = static_cast<node48 *>(n);
+                        if (n48->count < 48)
+                        {
+                            // Slots are never freed, so the next one is always count
+                            n48->children[n48->count] = child;
+                            n48->index[c] = static_cast<unsigned char>(++n48->count);
+                            return;
+                        }
+
+                        auto *grown = NodeResource<node256>::allocate();
+                        grown->take_header(*n48);
+                        for (size_t b = 0; b < 256; ++b)
+                        {
+                            if (n48->index[b]) grown->children[b] = n48->children[n48->index[b] - 1];
+                        }
+
+                        NodeResource<node48>::deallocate(n48);
+                        *ref = grown;
+                        add_child(ref, grown, c, child);
+                        return;
+                    }
+                    case __art_kind::node256:
+                    {
+                        auto *n256 = static_cast<node256 *>(n);
+                        n256->children[c] = child;
+                        ++n256->count;
+                        return;
+                    }
+                    default:
+                        return;
+                }
+            }
+
+            /// Calls fn on every child in byte order
+            template <typename F>
+            static void for_each_child(node *n, F &&fn)
+            {
+                switch (n->kind)
+                {
+                    case __art_kind::node4:
+                    {
+                        auto *n4 = static_cast<node4 *>(n);
+                        for (uint16_t i = 0; i < n4->count; ++i) fn(n4->children[i]);
+                        return;
+                    }
+                    case __art_kind::node16:
+                    {
+                        auto *n16 = static_cast<node16 *>(n);
+                        for (uint16_t i = 0; i < n16->count; ++i) fn(n16->children[i]);
+                        return;
+                    }
+                    case __art_kind::node48:
+                    {
+                        auto *n48 = static_cast<node48 *>(n);
+                        for (size_t b = 0; b < 256; ++b)
+                        {
+                            if (n48->index[b]) fn(n48->children[n48->index[b] - 1]);
+                        }
+
+                        return;
+                    }
+                    case __art_kind::node256:
+                    {
+                        auto *n256 = static_cast<node256 *>(n);
+                        for (size_t b = 0; b < 256; ++b)
+                        {
+                            if (n256->children[b]) fn(n256->children[b]);
+                        }
+
+                        return;
+                    }
+                    default:
+                        return;
+                }
+            }
+
+            /// Any leaf below the node; all of them share the node's full path
+            static leaf *any_leaf(__art_base *current)
+            {
+                while (current->kind != __art_kind::leaf)
+                {
+                    auto *n = static_cast<node *>(current);
+                    if (n->terminal) return n->terminal;
+
+                    __art_base *first = nullptr;
+                    for_each_child(n, [&first](__art_base *child) { if (!first) first = child; });
+                    current = first;
+                }
+
+                return static_cast<leaf *>(current);
+            }
+
+            /// Number of prefix bytes of n matching word from depth, resolving long prefixes through a leaf
+            static uint32_t prefix_mismatch(node *n, const char *word, const size_t size, const size_t depth)
+            {
+                const size_t remaining = size - depth;
+                const uint32_t limit = static_cast<uint32_t>(n->prefix_len < remaining ? n->prefix_len : remaining);
+                const uint32_t stored = limit < __art_max_prefix ? limit : __art_max_prefix;
+
+                uint32_t i = 0;
+                for (; i < stored; ++i)
+                {
+                    if (n->prefix[i] != byte_at(word, depth + i)) return i;
+                }
+
+                if (i < limit)
+                {
+                    const leaf *l = any_leaf(n);
+                    for (; i < limit; ++i)
+                    {
+                        if (l->key[depth + i] != word[depth + i]) return i;
+                    }
+                }
+
+                return i;
+            }
+
+            /// Attaches a leaf either as the terminal of n (when it ends at depth) or as the child for its next byte
+            static void place(node4 *n, leaf *l, const size_t depth)
+            {
+                if (l->len == depth)
+                {
+                    n->terminal = l;
+                }
+                else
+                {
+                    insert_sorted(n->keys, n->children, n->count, byte_at(l->key, depth), l);
+                    ++n->count;
+                }
+            }
+
+            /// Descends along word and returns the highest node whose path covers it, or nullptr
+            __art_base *locate_prefix(const char *word, const size_t n) const
+            {
+                __art_base *current = root;
+                size_t depth = 0;
+
+                while (current && depth < n && current->kind != __art_kind::leaf)
+                {
+                    auto *inner = static_cast<node *>(current);
+                    const size_t remaining = n - depth;
+                    const size_t limit = inner->prefix_len < remaining ? inner->prefix_len : remaining;
+                    const size_t stored = limit < __art_max_prefix ? limit : __art_max_prefix;
+                    for (size_t i = 0; i < stored; ++i)
+                    {
+                        if (inner->prefix[i] != byte_at(word, depth + i)) return nullptr;
+                    }
+
+                    depth += inner->prefix_len;
+                    if (depth >= n) break;
+
+                    __art_base **child = find_child(inner, byte_at(word, depth));
+                    current = child ? *child : nullptr;
+                    ++depth;
+                }
+
+                if (!current) return nullptr;
+
+                // Bytes skipped optimistically are checked against one leaf, all leaves below share them
+                const leaf *l = any_leaf(current);
+                return l->len >= n && (n == 0 || memcmp(l->key, word, n) == 0) ? current : nullptr;
+            }
+
+        public:
+            radix_trie() = default;
+            radix_trie(const radix_trie &) = delete;
+            radix_trie &operator=(const radix_trie &) = delete;
+
+            /**
+             * @brief Inserts a key.
+             *
+             * @param word Bytes of the key, any value allowed.
+             * @param n Length of the key.
+             * @return false if the key was already present.
+             */
+            bool insert(const char *word, const size_t n)
+            {
+                __art_base **ref = &root;
+                size_t depth = 0;
+
+                while (true)
+                {
+                    __art_base *current = *ref;
+                    if (!current)
+                    {
+                        *ref = make_leaf(word, n);
+                        break;
+                    }
+
+                    if (current->kind == __art_kind::leaf)
+                    {
+                        auto *existing = static_cast<leaf *>(current);
+                        if (existing->matches(word, n)) return false;
+
+                        // Split the leaf under a node4 holding the common part
+                        const size_t shortest = existing->len < n ? existing->len : n;
+                        size_t common = depth;
+                        while (common < shortest && existing->key[common] == word[common]) ++common;
+
+                        auto *split = NodeResource<node4>::allocate();
+                        split->prefix_len = static_cast<uint32_t>(common - depth);
+                        memcpy(split->prefix, word + depth, split->prefix_len < __art_max_prefix ? split->prefix_len : __art_max_prefix);
+
+                        place(split, existing, common);
+                        place(split, make_leaf(word, n), common);
+                        *ref = split;
+                        break;
+                    }
+
+                    auto *inner = static_cast<node *>(current);
+                    if (inner->prefix_len)
+                    {
+                        const uint32_t diff = prefix_mismatch(inner, word, n, depth);
+                        if (diff < inner->prefix_len)
+                        {
+                            // Split the compressed path at the first differing byte
+                            auto *split = NodeResource<node4>::allocate();
+                            split->prefix_len = diff;
+                            memcpy(split->prefix, inner->prefix, diff < __art_max_prefix ? diff : __art_max_prefix);
+
+                            unsigned char edge;
+                            if (inner->prefix_len <= __art_max_prefix)
+                            {
+                                edge = inner->prefix[diff];
+                                inner->prefix_len -= diff + 1;
+                                memmove(inner->prefix, inner->prefix + diff + 1, inner->prefix_len);
+                            }
+                            else
+                            {
+                                const leaf *l = any_leaf(inner);
+                                edge = byte_at(l->key, depth + diff);
+                                inner->prefix_len -= diff + 1;
+                                memcpy(inner->prefix, l->key + depth + diff + 1,
+                                    inner->prefix_len < __art_max_prefix ? inner->prefix_len : __art_max_prefix);
+                            }
+
+                            insert_sorted(split->keys, split->children, 0, edge, inner);
+                            split->count = 1;
+                            place(split, make_leaf(word, n), depth + diff);
+                            *ref = split;
+                            break;
+                        }
+
+                        depth += inner->prefix_len;
+                    }
+
+                    if (depth == n)
+                    {
+                        if (inner->terminal) return false;
+                        inner->terminal = make_leaf(word, n);
+                        break;
+                    }
+
+                    if (__art_base **child = find_child(inner, byte_at(word, depth)))
+                    {
+                        ref = child;
+                        ++depth;
+                        continue;
+                    }
+
+                    add_child(ref, inner, byte_at(word, depth), make_leaf(word, n));
+                    break;
+                }
+
+                ++len;
+                return true;
+            }
+
+            bool insert(const string<> &str)
+            {
+                return insert(const_cast<string<> &>(str).ptr(), str.size());
+            }
+
+            bool insert(const std::string &str)
+            {
+                return insert(str.data(), str.size());
+            }
+
+            /**
+             * @brief Checks whether the exact key is present.
+             */
+            [[nodiscard]] bool search(const char *word, const size_t n) const
+            {
+                const __art_base *current = root;
+                size_t depth = 0;
+
+                while (current)
+                {
+                    if (current->kind == __art_kind::leaf)
+                    {
+                        return static_cast<const leaf *>(current)->matches(word, n);
+                    }
+
+                    auto *inner = static_cast<node *>(const_cast<__art_base *>(current));
+                    if (inner->prefix_len)
+                    {
+                        if (depth + inner->prefix_len > n) return false;
+
+                        const uint32_t stored = inner->prefix_len < __art_max_prefix ? inner->prefix_len : __art_max_prefix;
+                        for (uint32_t i = 0; i < stored; ++i)
+                        {
+                            if (inner->prefix[i] != byte_at(word, depth + i)) return false;
+                        }
+
+                        depth += inner->prefix_len;
+                    }
+
+                    if (depth == n)
+                    {
+                        return inner->terminal && inner->terminal->matches(word, n);
+                    }
+
+                    __art_base **child = find_child(inner, byte_at(word, depth));
+                    current = child ? *child : nullptr;
+                    ++depth;
+                }
+
+                return false;
+            }
+
+            [[nodiscard]] bool search(const string<> &str) const
+            {
+                return search(const_cast<string<> &>(str).ptr(), str.size());
+            }
+
+            [[nodiscard]] bool search(const std::string &str) const
+            {
+                return search(str.data(), str.size());
+            }
+
+            /**
+             * @brief Checks whether any key starts with the given bytes.
+             */
+            [[nodiscard]] bool starts_with(const char *word, const size_t n) const
+            {
+                return locate_prefix(word, n) != nullptr;
+            }
+
+            [[nodiscard]] bool starts_with(const std::string &str) const
+            {
+                return starts_with(str.data(), str.size());
+            }
+
+            /**
+             * @brief Calls fn(const char *key, size_t len) for every key starting with the given bytes, in byte order.
+             */
+            template <typename F>
+            void for_each_prefix(const char *word, const size_t n, F &&fn) const
+            {
+                __art_base *start = locate_prefix(word, n);
+                if (!start) return;
+
+                vector<__art_base *> pending;
+                pending.push_back(start);
+                while (!pending.empty())
+                {
+                    __art_base *current = pending.pop_back_move();
+                    if (current->kind == __art_kind::leaf)
+                    {
+                        const auto *l = static_cast<leaf *>(current);
+                        fn(static_cast<const char *>(l->key), static_cast<size_t>(l->len));
+                        continue;
+                    }
+
+                    // Children are pushed in reverse so the smallest byte is visited first
+                    auto *inner = static_cast<node *>(current);
+                    const size_t mark = pending.size();
+                    for_each_child(inner, [&pending](__art_base *child) { pending.push_back(child); });
+                    for (size_t i = mark, j = pending.size() - 1; i < j; ++i, --j)
+                    {
+                        __art_base *tmp = pending[i];
+                        pending[i] = pending[j];
+                        pending[j] = tmp;
+                    }
+
+                    if (inner->terminal) pending.push_back(inner->terminal);
+                }
+            }
+
+            /**
+             * @brief Calls fn(const char *key, size_t len) for every key, in byte order.
+             */
+            template <typename F>
+            void for_each(F &&fn) const
+            {
+                for_each_prefix("", 0, stl::forward<F>(fn));
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return len;
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return len == 0;
+            }
+
+            ~radix_trie()
+            {
+                if (!root) return;
+
+                // Destroy all nodes using a queue to avoid deep recursion
+                vector<__art_base *> to_delete;
+                to_delete.push_back(root);
+
+                while (!to_delete.empty())
+                {
+                    __art_base *current = to_delete.pop_back_move();
+                    switch (current->kind)
+                    {
+                        case __art_kind::leaf:
+                        {
+                            auto *l = static_cast<leaf *>(current);
+                            if (l->key) KeyAllocator::deallocate(l->key);
+                            NodeResource<leaf>::deallocate(l);
+                            continue;
+                        }
+                        default:
+                            break;
+                    }
+
+                    auto *inner = static_cast<node *>(current);
+                    for_each_child(inner, [&to_delete](__art_base *child) { to_delete.push_back(child); });
+                    if (inner->terminal) to_delete.push_back(inner->terminal);
+
+                    switch (inner->kind)
+                    {
+                        case __art_kind::node4: NodeResource<node4>::deallocate(static_cast<node4 *>(inner)); break;
+                        case __art_kind::node16: NodeResource<node16>::deallocate(static_cast<node16 *>(inner)); break;
+                        case __art_kind::node48: NodeResource<node48>::deallocate(static_cast<node48 *>(inner)); break;
+                        default: NodeResource<node256>::deallocate(static_cast<node256 *>(inner)); break;
+                    }
+                }
+            }
+        };
+    }
+
+    using radix_trie = pmr::radix_trie<>;
+}
@@ -0,0 +1,66 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/5/25.
+//
+
+#pragma once
+
+namespace zelix::stl
+{
+    /**
+     * \brief A lightweight view over a half-open iterator range [begin, end).
+     *
+     * Does not own the underlying elements; it is only valid as long as the
+     * container it was taken from is not modified.
+     *
+     * \tparam Iterator Iterator type of the underlying container.
+     */
+    template <typename Iterator>
+    class iterator_range
+    {
+        Iterator begin_;
+        Iterator end_;
+
+    public:
+        iterator_range(Iterator begin, Iterator end) : begin_(begin), end_(end) {}
+
+        Iterator begin() const
+        {
+            return begin_;
+        }
+
+        Iterator end() const
+        {
+            return end_;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return begin_ == end_;
+        }
+    };
+}
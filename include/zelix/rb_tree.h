@@ -32,6 +32,9 @@
 
 #include "except/element_not_found.h"
 #include "memory/monotonic.h"
+#include "probe.h"
+#include "range.h"
+#include "vector.h"
 
 namespace zelix::stl
 {
@@ -234,16 +237,63 @@ namespace zelix::stl
                 unified_insert(ChildrenAllocator::allocate(key, value, true, nil_, nil_, nullptr));
             }
 
-            // Remove a key (if present)
-            bool erase(const T &key)
+            /**
+             * @brief Replaces the contents of the tree with the sorted range [first, last).
+             *
+             * Builds a perfectly balanced tree in O(n) instead of n rebalancing inserts.
+             * Equal adjacent keys are skipped. For maps, elements may be `stl::pair`
+             * (first()/second()), anything with `first`/`second` members, or tree nodes.
+             *
+             * @param first Iterator to the smallest element.
+             * @param last Iterator one past the largest element.
+             */
+            template <typename Iterator>
+            void build_from_sorted(Iterator first, Iterator last)
             {
+                clear(root_);
+                root_ = nil_;
+                len_ = 0;
+
+                // Take every node from the allocator in one pass before linking
+                vector<pointer, DestructorQueueGrowthFactor, DestructorQueueInitialCapacity, DestructorQueueAllocator>
+                        nodes;
+                if constexpr (requires { last - first; })
+                    nodes.reserve(static_cast<size_t>(last - first));
+
+                for (; first != last; ++first)
+                {
+                    const auto &element = *first;
+                    const auto &key = sorted_key(element);
+                    if (!nodes.empty() && !(nodes.back()->key < key))
+                        continue; // equal -> ignore duplicate
+
+                    if constexpr (IsPair)
+                        nodes.push_back(
+                            ChildrenAllocator::allocate(key, sorted_value(element), false, nil_, nil_, nil_));
+                    else
+                        nodes.push_back(ChildrenAllocator::allocate(key, false, nil_, nil_, nil_));
+                }
+
+                len_ = nodes.size();
                 if (len_ == 0)
-                    return false; // Tree is empty
-                len_--;
+                    return;
+
+                // Only the deepest level is red, so every path has the same black height
+                size_t max_depth = 0;
+                while ((static_cast<size_t>(2) << max_depth) <= len_)
+                    max_depth++;
+
+                root_ = link_sorted(nodes.ptr(), 0, len_, 0, max_depth, nil_);
+            }
 
-                pointer z = search(key);
+            // Remove a key (if present)
+            bool erase(const T &key)
+            {
+                pointer z = lookup(key);
                 if (z == nil_)
                     return false;
+                len_--;
+
                 pointer y = z;
                 pointer x = nullptr;
                 bool y_original_color = y->red;
@@ -286,13 +336,20 @@ namespace zelix::stl
             // Check if a key exists in the tree
             bool contains(const T &key) const
             {
-                try
-                {
-                    return search(key);
-                } catch (...)
-                {
-                    return false;
-                }
+                return lookup(key) != nil_;
+            }
+
+            // Find the node with the given key, or end() if it is not present
+            iterator find(const T &key)
+            {
+                return iterator(lookup(key), nil_);
+            }
+
+            // Find the node with the given key, or nullptr if it is not present
+            pointer find_ptr(const T &key) const
+            {
+                pointer x = lookup(key);
+                return x == nil_ ? nullptr : x;
             }
 
             [[nodiscard]] size_t size() const
@@ -305,21 +362,65 @@ namespace zelix::stl
                 return len_ == 0;
             }
 
-            // Find a node with the given key in subtree x
-            pointer search(const T &key) const
+            // First node whose key is not less than key, or end()
+            iterator lower_bound(const T &key)
+            {
+                pointer result = nil_;
+                pointer x = root_;
+                while (x != nil_)
+                {
+                    if (x->key < key)
+                        x = x->right;
+                    else
+                    {
+                        result = x;
+                        x = x->left;
+                    }
+                }
+
+                return iterator(result, nil_);
+            }
+
+            // First node whose key is greater than key, or end()
+            iterator upper_bound(const T &key)
             {
+                pointer result = nil_;
                 pointer x = root_;
                 while (x != nil_)
                 {
                     if (key < x->key)
+                    {
+                        result = x;
                         x = x->left;
-                    else if (x->key < key)
-                        x = x->right;
+                    }
                     else
-                        return x;
+                        x = x->right;
                 }
 
-                throw except::element_not_found();
+                return iterator(result, nil_);
+            }
+
+            // Nodes whose key is equal to key (at most one, since keys are unique)
+            iterator_range<iterator> equal_range(const T &key)
+            {
+                return iterator_range<iterator>(lower_bound(key), upper_bound(key));
+            }
+
+            // Nodes whose key lies in [from, to)
+            iterator_range<iterator> range(const T &from, const T &to)
+            {
+                if (!(from < to))
+                    return iterator_range<iterator>(end(), end());
+                return iterator_range<iterator>(lower_bound(from), lower_bound(to));
+            }
+
+            // Find a node with the given key in subtree x
+            pointer search(const T &key) const
+            {
+                pointer x = lookup(key);
+                if (x == nil_)
+                    throw except::element_not_found();
+                return x;
             }
 
             // Clear all nodes in the subtree rooted at x
@@ -365,12 +466,67 @@ namespace zelix::stl
         private:
             pointer root_; // Root of the tree
             pointer nil_; // Sentinel NIL node
-            size_t len_; // Number of nodes in the tree
+            size_t len_ = 0; // Number of nodes in the tree
+
+            // Find the node with the given key, or nil_ if it is not present
+            pointer lookup(const T &key) const
+            {
+                pointer x = root_;
+                while (x != nil_)
+                {
+                    if (key < x->key)
+                        x = x->left;
+                    else if (x->key < key)
+                        x = x->right;
+                    else
+                        return x;
+                }
+
+                return nil_;
+            }
+
+            template <typename E>
+            static decltype(auto) sorted_key(const E &element)
+            {
+                if constexpr (requires { element.first(); })
+                    return (element.first());
+                else if constexpr (requires { element.first; })
+                    return (element.first);
+                else if constexpr (requires { element.key; })
+                    return (element.key);
+                else
+                    return (element);
+            }
+
+            template <typename E>
+            static decltype(auto) sorted_value(const E &element)
+            {
+                if constexpr (requires { element.second(); })
+                    return (element.second());
+                else if constexpr (requires { element.second; })
+                    return (element.second);
+                else
+                    return (element.value);
+            }
+
+            // Link nodes[lo, hi) into a balanced subtree and return its root
+            pointer link_sorted(pointer *nodes, size_t lo, size_t hi, size_t depth, size_t max_depth, pointer parent)
+            {
+                if (lo == hi)
+                    return nil_;
+
+                const size_t mid = lo + (hi - lo) / 2;
+                pointer node = nodes[mid];
+                node->parent = parent;
+                node->red = depth == max_depth && depth > 0;
+                node->left = link_sorted(nodes, lo, mid, depth + 1, max_depth, node);
+                node->right = link_sorted(nodes, mid + 1, hi, depth + 1, max_depth, node);
+                return node;
+            }
 
             // Insertion
             void unified_insert(pointer c)
             {
-                len_++;
                 pointer y = nil_;
                 pointer x = root_;
                 while (x != nil_)
@@ -387,6 +543,7 @@ namespace zelix::stl
                     }
                 }
 
+                len_++;
                 c->parent = y;
                 if (y == nil_)
                     root_ = c;
@@ -464,11 +621,13 @@ namespace zelix::stl
                                 // Case 2: z is right child
                                 z = z->parent;
                                 left_rotate(z);
+                                ZELIX_STL_PROBE(rb_tree_rotate);
                             }
                             // Case 3: z is left child
                             z->parent->red = false;
                             z->parent->parent->red = true;
                             right_rotate(z->parent->parent);
+                            ZELIX_STL_PROBE(rb_tree_rotate);
                         }
                     }
                     else
@@ -488,11 +647,13 @@ namespace zelix::stl
                                 // Case 2: z is left child
                                 z = z->parent;
                                 right_rotate(z);
+                                ZELIX_STL_PROBE(rb_tree_rotate);
                             }
                             // Case 3: z is right child
                             z->parent->red = false;
                             z->parent->parent->red = true;
                             left_rotate(z->parent->parent);
+                            ZELIX_STL_PROBE(rb_tree_rotate);
                         }
                     }
                 }
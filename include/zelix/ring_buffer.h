@@ -237,6 +237,16 @@ namespace zelix::stl
                 head++;
             }
 
+            /**
+             * \brief Advances the head past elements written directly through ptr().
+             *
+             * \param count Number of elements that were written after the head.
+             */
+            void commit(const size_t count)
+            {
+                head += count;
+            }
+
             /**
              * \brief Returns a pointer to the internal data array.
              *
@@ -0,0 +1,645 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <xxh3.h>
+
+#include "except/out_of_range.h"
+#include "external_string.h"
+#include "memory/arena.h"
+#include "memory/monotonic.h"
+#include "owned_string.h"
+#include "string_utils.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        struct __rope_node
+        {
+            const char *data;
+            size_t len;
+            size_t newlines; ///< Line breaks inside this piece
+            size_t size; ///< Bytes in the whole subtree
+            size_t lines; ///< Line breaks in the whole subtree
+            uint64_t priority;
+            __rope_node *left = nullptr, *right = nullptr;
+
+            __rope_node(const char *data, const size_t len, const size_t newlines, const uint64_t priority) :
+                data(data), len(len), newlines(newlines), size(len), lines(newlines), priority(priority)
+            {
+            }
+        };
+
+        /**
+         * \brief A text buffer for large documents with frequent edits in the middle.
+         *
+         * The text is kept as a sequence of pieces in an implicit treap, keyed by
+         * byte offset. Every node caches the byte and line break totals of its
+         * subtree, so insert, erase, random access and offset/line conversions
+         * are O(log n) in the number of pieces, no matter how large the text is.
+         *
+         * Inserted text is copied into an arena owned by the rope and never moved
+         * again; erasing only unlinks pieces. Typing at a cursor extends the last
+         * piece in place instead of creating a new one. insert_external() adds a
+         * piece that points at caller-owned memory without copying it.
+         *
+         * \tparam NodeAllocator Resource used for the tree nodes.
+         */
+        template <
+            typename NodeAllocator = memory::monotonic_resource<__rope_node>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::resource<__rope_node>, NodeAllocator>
+            >
+        >
+        class rope
+        {
+            using node = __rope_node;
+
+            node *root_ = nullptr;
+            memory::arena text_;
+            unsigned char *last_ = nullptr; ///< Most recent arena block, can still grow in place
+            size_t last_len_ = 0;
+            uint64_t seed_ = 0x9E3779B97F4A7C15ull;
+
+            static size_t size_of(const node *n)
+            {
+                return n ? n->size : 0;
+            }
+
+            static size_t lines_of(const node *n)
+            {
+                return n ? n->lines : 0;
+            }
+
+            static void update(node *n)
+            {
+                n->size = n->len + size_of(n->left) + size_of(n->right);
+                n->lines = n->newlines + lines_of(n->left) + lines_of(n->right);
+            }
+
+            uint64_t next_priority()
+            {
+                // xorshift64, only has to be well spread, not unpredictable
+                seed_ ^= seed_ << 13;
+                seed_ ^= seed_ >> 7;
+                seed_ ^= seed_ << 17;
+                return seed_;
+            }
+
+            node *make_node(const char *data, const size_t len, const size_t newlines)
+            {
+                return NodeAllocator::allocate(data, len, newlines, next_priority());
+            }
+
+            static void destroy(node *n)
+            {
+                if (!n) return;
+
+                destroy(n->left);
+                destroy(n->right);
+                NodeAllocator::deallocate(n);
+            }
+
+            static node *merge(node *a, node *b)
+            {
+                if (!a) return b;
+                if (!b) return a;
+
+                if (a->priority > b->priority)
+                {
+                    a->right = merge(a->right, b);
+                    update(a);
+                    return a;
+                }
+
+                b->left = merge(a, b->left);
+                update(b);
+                return b;
+            }
+
+            // Splits t into [0, pos) and [pos, size), cutting a piece in two if needed
+            void split(node *t, const size_t pos, node *&l, node *&r)
+            {
+                if (!t)
+                {
+                    l = r = nullptr;
+                    return;
+                }
+
+                const size_t left_size = size_of(t->left);
+                if (pos <= left_size)
+                {
+                    split(t->left, pos, l, t->left);
+                    update(t);
+                    r = t;
+                }
+                else if (pos >= left_size + t->len)
+                {
+                    split(t->right, pos - left_size - t->len, t->right, r);
+                    update(t);
+                    l = t;
+                }
+                else
+                {
+                    // pos falls inside this piece, the tail becomes its own node
+                    const size_t cut = pos - left_size;
+                    const size_t head_lines = str::count_char(t->data, cut, '\n');
+                    node *tail = make_node(t->data + cut, t->len - cut, t->newlines - head_lines);
+
+                    tail->right = t->right;
+                    update(tail);
+                    t->right = nullptr;
+                    t->len = cut;
+                    t->newlines = head_lines;
+                    update(t);
+
+                    l = t;
+                    r = tail;
+                }
+            }
+
+            // Grows the piece ending at pos in place when it ends at the arena's top
+            bool try_extend(const size_t pos, const char *s, const size_t n)
+            {
+                if (!last_ || pos == 0) return false;
+
+                // Find the piece ending exactly at pos
+                const node *t = root_;
+                size_t p = pos;
+                while (t)
+                {
+                    const size_t left_size = size_of(t->left);
+                    if (p <= left_size)
+                    {
+                        t = t->left;
+                    }
+                    else if (p <= left_size + t->len)
+                    {
+                        break;
+                    }
+                    else
+                    {
+                        p -= left_size + t->len;
+                        t = t->right;
+                    }
+                }
+
+                if (
+                    !t || p - size_of(t->left) != t->len ||
+                    t->data + t->len != reinterpret_cast<const char *>(last_ + last_len_) ||
+                    !text_.resize_last(last_, last_len_, last_len_ + n)
+                )
+                {
+                    return false;
+                }
+
+                memcpy(last_ + last_len_, s, n);
+                last_len_ += n;
+
+                // Same descent again, now adding the new bytes along the path
+                const size_t added_lines = str::count_char(s, n, '\n');
+                node *cur = root_;
+                p = pos;
+                while (true)
+                {
+                    cur->size += n;
+                    cur->lines += added_lines;
+
+                    const size_t left_size = size_of(cur->left);
+                    if (p <= left_size)
+                    {
+                        cur = cur->left;
+                    }
+                    else if (p <= left_size + cur->len)
+                    {
+                        cur->len += n;
+                        cur->newlines += added_lines;
+                        return true;
+                    }
+                    else
+                    {
+                        p -= left_size + cur->len;
+                        cur = cur->right;
+                    }
+                }
+            }
+
+            void insert_piece(const size_t pos, const char *data, const size_t len)
+            {
+                node *l, *r;
+                split(root_, pos, l, r);
+                root_ = merge(merge(l, make_node(data, len, str::count_char(data, len, '\n'))), r);
+            }
+
+            template <typename Fn>
+            static void visit(const node *t, size_t from, size_t to, Fn &fn)
+            {
+                // [from, to) is relative to the start of t's subtree
+                while (t && from < to)
+                {
+                    const size_t left_size = size_of(t->left);
+                    if (from < left_size)
+                    {
+                        visit(t->left, from, to < left_size ? to : left_size, fn);
+                    }
+
+                    const size_t piece_end = left_size + t->len;
+                    if (from < piece_end && to > left_size)
+                    {
+                        const size_t begin = from > left_size ? from - left_size : 0;
+                        const size_t end = (to < piece_end ? to : piece_end) - left_size;
+                        fn(external_string(t->data + begin, end - begin));
+                    }
+
+                    if (to <= piece_end) return;
+
+                    from = from > piece_end ? from - piece_end : 0;
+                    to -= piece_end;
+                    t = t->right;
+                }
+            }
+
+        public:
+            rope() = default;
+
+            explicit rope(const char *s, const size_t n)
+            {
+                append(s, n);
+            }
+
+            rope(const char *s) : rope(s, str::len(s)) {}
+
+            rope(const rope &other)
+            {
+                // The copy owns its text, flattened into a single piece
+                if (const size_t n = other.size())
+                {
+                    auto buf = static_cast<char *>(text_.allocate(n, 1));
+                    size_t off = 0;
+                    other.for_each_chunk([&](const external_string &chunk)
+                    {
+                        memcpy(buf + off, chunk.ptr(), chunk.size());
+                        off += chunk.size();
+                    });
+
+                    root_ = make_node(buf, n, other.line_breaks());
+                }
+            }
+
+            rope(rope &&other) noexcept :
+                root_(other.root_), text_(stl::move(other.text_)), last_(other.last_),
+                last_len_(other.last_len_), seed_(other.seed_)
+            {
+                other.root_ = nullptr;
+                other.last_ = nullptr;
+                other.last_len_ = 0;
+            }
+
+            rope &operator=(const rope &other)
+            {
+                if (this != &other)
+                {
+                    rope copy(other);
+                    *this = stl::move(copy);
+                }
+
+                return *this;
+            }
+
+            rope &operator=(rope &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    destroy(root_);
+                    root_ = other.root_;
+                    text_ = stl::move(other.text_);
+                    last_ = other.last_;
+                    last_len_ = other.last_len_;
+                    seed_ = other.seed_;
+
+                    other.root_ = nullptr;
+                    other.last_ = nullptr;
+                    other.last_len_ = 0;
+                }
+
+                return *this;
+            }
+
+            ~rope()
+            {
+                destroy(root_);
+            }
+
+            /// Number of bytes in the rope
+            [[nodiscard]] size_t size() const
+            {
+                return size_of(root_);
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return root_ == nullptr;
+            }
+
+            /// Number of '\n' characters in the rope
+            [[nodiscard]] size_t line_breaks() const
+            {
+                return lines_of(root_);
+            }
+
+            /// Number of lines, a trailing line without a break counts as one
+            [[nodiscard]] size_t line_count() const
+            {
+                return line_breaks() + 1;
+            }
+
+            /**
+             * @brief Copies n bytes into the rope before byte offset pos.
+             * @throws except::out_of_range if pos is past the end.
+             */
+            void insert(const size_t pos, const char *s, const size_t n)
+            {
+                if (pos > size()) throw except::out_of_range("Rope insert position out of range");
+                if (n == 0) return;
+
+                if (try_extend(pos, s, n)) return;
+
+                auto buf = static_cast<unsigned char *>(text_.allocate(n, 1));
+                memcpy(buf, s, n);
+                last_ = buf;
+                last_len_ = n;
+
+                insert_piece(pos, reinterpret_cast<const char *>(buf), n);
+            }
+
+            void insert(const size_t pos, const char *s)
+            {
+                insert(pos, s, str::len(s));
+            }
+
+            void insert(const size_t pos, const external_string &s)
+            {
+                insert(pos, s.ptr(), s.size());
+            }
+
+            template <double GrowthFactor, typename Allocator>
+            void insert(const size_t pos, const string<GrowthFactor, Allocator> &s)
+            {
+                insert(pos, s.ptr(), s.size());
+            }
+
+            /**
+             * @brief Inserts a piece referencing s without copying it.
+             *
+             * The caller keeps the memory alive and unchanged for as long as the
+             * rope (or anything copied out of it lazily) is in use.
+             */
+            void insert_external(const size_t pos, const external_string &s)
+            {
+                if (pos > size()) throw except::out_of_range("Rope insert position out of range");
+                if (s.size() == 0) return;
+
+                insert_piece(pos, s.ptr(), s.size());
+            }
+
+            void append(const char *s, const size_t n)
+            {
+                insert(size(), s, n);
+            }
+
+            void append(const char *s)
+            {
+                insert(size(), s, str::len(s));
+            }
+
+            /**
+             * @brief Removes n bytes starting at byte offset pos.
+             *
+             * The count is clamped to the end of the rope.
+             * @throws except::out_of_range if pos is past the end.
+             */
+            void erase(const size_t pos, size_t n)
+            {
+                const size_t total = size();
+                if (pos > total) throw except::out_of_range("Rope erase position out of range");
+                if (n > total - pos) n = total - pos;
+                if (n == 0) return;
+
+                node *l, *mid, *r;
+                split(root_, pos, l, r);
+                split(r, n, mid, r);
+                destroy(mid);
+                root_ = merge(l, r);
+
+                // The arena keeps the bytes, but they are no longer backed by a piece
+                last_ = nullptr;
+                last_len_ = 0;
+            }
+
+            /// Removes everything, dropping the stored text as well
+            void clear()
+            {
+                destroy(root_);
+                root_ = nullptr;
+                text_.reset();
+                last_ = nullptr;
+                last_len_ = 0;
+            }
+
+            /**
+             * @brief Returns the byte at offset pos.
+             * @throws except::out_of_range if pos is not a valid offset.
+             */
+            [[nodiscard]] char at(size_t pos) const
+            {
+                if (pos >= size()) throw except::out_of_range("Rope index out of range");
+
+                const node *t = root_;
+                while (true)
+                {
+                    const size_t left_size = size_of(t->left);
+                    if (pos < left_size)
+                    {
+                        t = t->left;
+                    }
+                    else if (pos < left_size + t->len)
+                    {
+                        return t->data[pos - left_size];
+                    }
+                    else
+                    {
+                        pos -= left_size + t->len;
+                        t = t->right;
+                    }
+                }
+            }
+
+            [[nodiscard]] char operator[](const size_t pos) const
+            {
+                return at(pos);
+            }
+
+            /**
+             * @brief Calls fn with each piece overlapping [pos, pos + n), in order.
+             *
+             * Pieces are passed as external_string views into the rope, no text is
+             * copied. The count is clamped to the end of the rope.
+             */
+            template <typename Fn>
+            void for_each_chunk(const size_t pos, const size_t n, Fn &&fn) const
+            {
+                const size_t total = size();
+                if (pos >= total) return;
+
+                const size_t end = n > total - pos ? total : pos + n;
+                visit(root_, pos, end, fn);
+            }
+
+            template <typename Fn>
+            void for_each_chunk(Fn &&fn) const
+            {
+                visit(root_, 0, size(), fn);
+            }
+
+            /**
+             * @brief Copies [pos, pos + n) into a flat string.
+             * @throws except::out_of_range if pos is past the end.
+             */
+            [[nodiscard]] stl::string substr(const size_t pos, const size_t n) const
+            {
+                if (pos > size()) throw except::out_of_range("Rope substring position out of range");
+
+                const size_t count = n > size() - pos ? size() - pos : n;
+                stl::string out(count);
+                for_each_chunk(pos, count, [&](const external_string &chunk)
+                {
+                    out.push(chunk.ptr(), chunk.size());
+                });
+
+                return out;
+            }
+
+            /// Copies the whole rope into a flat string
+            [[nodiscard]] stl::string flatten() const
+            {
+                return substr(0, size());
+            }
+
+            /// Zero-based line containing byte offset pos (pos may equal size())
+            [[nodiscard]] size_t line_of(size_t pos) const
+            {
+                if (pos > size()) throw except::out_of_range("Rope offset out of range");
+
+                size_t line = 0;
+                const node *t = root_;
+                while (t)
+                {
+                    const size_t left_size = size_of(t->left);
+                    if (pos < left_size)
+                    {
+                        t = t->left;
+                    }
+                    else if (pos <= left_size + t->len)
+                    {
+                        const size_t in_piece = pos - left_size;
+                        return line + lines_of(t->left) + str::count_char(t->data, in_piece, '\n');
+                    }
+                    else
+                    {
+                        line += lines_of(t->left) + t->newlines;
+                        pos -= left_size + t->len;
+                        t = t->right;
+                    }
+                }
+
+                return line;
+            }
+
+            /**
+             * @brief Byte offset of the first character of a zero-based line.
+             * @throws except::out_of_range if the line does not exist.
+             */
+            [[nodiscard]] size_t line_start(size_t line) const
+            {
+                if (line >= line_count()) throw except::out_of_range("Rope line out of range");
+                if (line == 0) return 0;
+
+                // Find the (line)th line break, the line starts right after it
+                size_t offset = 0;
+                const node *t = root_;
+                while (true)
+                {
+                    const size_t left_lines = lines_of(t->left);
+                    if (line <= left_lines)
+                    {
+                        t = t->left;
+                    }
+                    else if (line <= left_lines + t->newlines)
+                    {
+                        offset += size_of(t->left);
+                        size_t remaining = line - left_lines;
+                        size_t i = 0;
+                        while (true)
+                        {
+                            i += str::find_char(t->data + i, t->len - i, '\n');
+                            if (--remaining == 0) return offset + i + 1;
+                            i++;
+                        }
+                    }
+                    else
+                    {
+                        line -= left_lines + t->newlines;
+                        offset += size_of(t->left) + t->len;
+                        t = t->right;
+                    }
+                }
+            }
+
+            /// XXH3 of the contents, equal to hashing the flattened text
+            [[nodiscard]] uint64_t hash() const
+            {
+                XXH3_state_t state;
+                XXH3_64bits_reset(&state);
+                for_each_chunk([&](const external_string &chunk)
+                {
+                    XXH3_64bits_update(&state, chunk.ptr(), chunk.size());
+                });
+
+                return XXH3_64bits_digest(&state);
+            }
+        };
+    } // namespace pmr
+
+    using rope = pmr::rope<>;
+}
@@ -76,6 +76,20 @@ namespace zelix::stl
                 tree_.insert(key);
             }
 
+            /**
+             * \brief Replaces the contents of the set with an already sorted range.
+             *
+             * Runs in linear time by building a balanced tree directly.
+             *
+             * \param first Iterator to the smallest element.
+             * \param last Iterator one past the largest element.
+             */
+            template <typename Iterator>
+            void assign_sorted(Iterator first, Iterator last)
+            {
+                tree_.build_from_sorted(first, last);
+            }
+
             /**
              * \brief Removes a key (and its value) from the set.
              * \param key The key to remove.
@@ -96,6 +110,57 @@ namespace zelix::stl
                 return tree_.contains(key);
             }
 
+            /**
+             * \brief Finds a key in the set.
+             * \param key The key to look up.
+             * \return Iterator to the key, or end() if it does not exist.
+             */
+            tree::iterator find(const Key &key)
+            {
+                return tree_.find(key);
+            }
+
+            /**
+             * \brief Returns an iterator to the first key whose key is not less than key.
+             * \param key The key to compare against.
+             * \return Iterator to the key, or end() if there is none.
+             */
+            tree::iterator lower_bound(const Key &key)
+            {
+                return tree_.lower_bound(key);
+            }
+
+            /**
+             * \brief Returns an iterator to the first key whose key is greater than key.
+             * \param key The key to compare against.
+             * \return Iterator to the key, or end() if there is none.
+             */
+            tree::iterator upper_bound(const Key &key)
+            {
+                return tree_.upper_bound(key);
+            }
+
+            /**
+             * \brief Returns the keys equal to key.
+             * \param key The key to look up.
+             * \return A view holding the matching keys (at most one).
+             */
+            iterator_range<typename tree::iterator> equal_range(const Key &key)
+            {
+                return tree_.equal_range(key);
+            }
+
+            /**
+             * \brief Returns a view over the keys whose key lies in [from, to).
+             * \param from Inclusive lower bound.
+             * \param to Exclusive upper bound.
+             * \return A view over the matching keys, in ascending order.
+             */
+            iterator_range<typename tree::iterator> range(const Key &from, const Key &to)
+            {
+                return tree_.range(from, to);
+            }
+
             /**
              * \brief Returns an iterator to the beginning of the set.
              * \return Iterator to the first element.
@@ -22,165 +22,168 @@
     Public License along with Zelix. If not, see
     <https://www.gnu.org/licenses/>.
 */
-
 #pragma once
 #include <atomic>
-#include <tuple>
 #include <type_traits>
 
 #include "zelix/forward.h"
-#include "zelix/memory/array_resource.h"
 #include "zelix/memory/monotonic.h"
 #include "zelix/memory/resource.h"
-#include "zelix/memory/system_resource.h"
+#include "zelix/memory/thread_cache.h"
+#include "zelix/relocatable.h"
 
 namespace zelix::stl
 {
     namespace pmr
     {
+        /// Reference count type: a plain int, or an atomic one for concurrent pointers
+        template <bool Concurrent>
+        using __ref_count_t = std::conditional_t<Concurrent, std::atomic<int>, int>;
+
+        /// Takes a new reference; relaxed since the caller already holds one
+        template <bool Concurrent>
+        void __ref_acquire(__ref_count_t<Concurrent> &count)
+        {
+            if constexpr (Concurrent)
+            {
+                count.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                ++count;
+            }
+        }
+
+        /// Drops a reference and returns whether it was the last one
+        template <bool Concurrent>
+        bool __ref_release(__ref_count_t<Concurrent> &count)
+        {
+            if constexpr (Concurrent)
+            {
+                // acq_rel: our writes happen before the destruction, which sees everyone else's
+                return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            }
+            else
+            {
+                return --count == 0;
+            }
+        }
+
+        /**
+         * @brief Control block of a shared_ptr, holding the count and the object in one allocation.
+         */
+        template <typename T, bool Concurrent>
+        struct __shared_block
+        {
+            __ref_count_t<Concurrent> count = 1;
+            T value;
+
+            template <typename ...Args>
+            explicit __shared_block(Args &&...args)
+                : value(stl::forward<Args>(args)...)
+            {}
+        };
+
+        template <typename T, size_t N, bool Concurrent>
+        struct __shared_block<T[N], Concurrent>
+        {
+            __ref_count_t<Concurrent> count = 1;
+            T value[N];
+
+            template <typename Array>
+            explicit __shared_block(const Array &arr)
+            {
+                for (size_t i = 0; i < N; ++i)
+                {
+                    static_assert(
+                        std::is_convertible_v<std::remove_reference_t<decltype(arr[i])>, T>,
+                        "Array element type mismatch"
+                    );
+
+                    value[i] = arr[i];
+                }
+            }
+        };
+
+        /**
+         * @brief Reference-counted pointer with a single allocation per object.
+         *
+         * The count lives next to the object in a __shared_block, so the
+         * handle is one pointer wide and sharing an object never touches more
+         * than one cache line of bookkeeping.
+         *
+         * @tparam T Managed type (may be a fixed-size array).
+         * @tparam Concurrent Whether the count is atomic.
+         * @tparam ConcurrentAllocation Whether blocks come from a thread-safe allocator.
+         * @tparam Allocator Allocator for the control blocks.
+         */
         template <
             typename T,
             bool Concurrent,
             bool ConcurrentAllocation,
             typename Allocator = std::conditional_t<
-                std::is_array_v<T>,
-                memory::system_array_resource<T>,
-                std::conditional_t<
-                    ConcurrentAllocation,
-                    memory::concurrent_monotonic_resource<T>,
-                    memory::monotonic_resource<T>
-                >
-            >,
-            typename ARefCountAllocator = memory::monotonic_resource<std::atomic<int>>,
-            typename RefCountAllocator = memory::monotonic_resource<int>,
-            typename = std::enable_if_t<
-                std::is_base_of_v<
-                    std::conditional_t<
-                        std::is_array_v<T>,
-                        memory::array_resource<std::remove_extent_t<T>>,
-                        memory::resource<T>
-                    >,
-                    Allocator
-                >
+                ConcurrentAllocation,
+                memory::thread_cached_resource<__shared_block<T, Concurrent>>,
+                memory::monotonic_resource<__shared_block<T, Concurrent>>
             >,
             typename = std::enable_if_t<
-                std::is_base_of_v<memory::resource<std::atomic<int>>, ARefCountAllocator>
-            >,
-            typename = std::enable_if_t<
-                std::is_base_of_v<memory::resource<int>, RefCountAllocator>
+                std::is_base_of_v<memory::resource<__shared_block<T, Concurrent>>, Allocator>
             >
         >
         class shared_ptr
         {
-            int *ref_count = nullptr; ///< Pointer to reference count
-            T *ptr = nullptr; ///< Pointer to the managed object
-            std::atomic<int> *atomic_ref_count = nullptr; ///< Atomic reference count for thread safety
+            using block_type = __shared_block<T, Concurrent>;
+            block_type *block = nullptr; ///< Control block holding the count and the object
 
-            void destroy()
+            void release()
             {
-                if (!ptr) return;
-                Allocator::deallocate(ptr); // Deallocate the managed object memory
-
-                if constexpr (Concurrent)
+                if (block && __ref_release<Concurrent>(block->count))
                 {
-                    ARefCountAllocator::deallocate(atomic_ref_count); // Free atomic reference count if used
-                    atomic_ref_count = nullptr;
-                }
-                else
-                {
-                    RefCountAllocator::deallocate(ref_count); // Free reference count if not using atomic
-                    ref_count = nullptr;
+                    Allocator::deallocate(block); // Destroys the object along with its count
                 }
 
-                ptr = nullptr;
+                block = nullptr;
             }
 
             void add_ref_count()
             const {
-                if constexpr (Concurrent)
+                if (block)
                 {
-                    if (atomic_ref_count)
-                    {
-                        atomic_ref_count->fetch_add(1); // Increment atomic reference count
-                    }
-                }
-                else
-                {
-                    if (ref_count)
-                    {
-                        ++(*ref_count); // Increment reference count
-                    }
+                    __ref_acquire<Concurrent>(block->count);
                 }
             }
         public:
             template <typename ...Args>
             shared_ptr(Args &&...args)
+                : block(Allocator::allocate(stl::forward<Args>(args)...))
             {
                 if constexpr (std::is_array_v<T>)
                 {
-                    ptr = Allocator::allocate(std::extent_v<T>);
-
-                    // Move all elements
                     static_assert(sizeof...(args) == 1,
                            "Array case expects exactly one arg");
-
-                    auto&& arr = std::get<0>(std::forward_as_tuple(args...));
-                    constexpr size_t N = std::extent_v<T>;
-
-                    for (std::size_t i = 0; i < N; ++i)
-                    {
-                        static_assert(
-                            std::is_convertible_v<
-                                std::remove_reference_t<decltype(arr[i])>,
-                                std::remove_extent_t<T>
-                            >,
-                            "Array element type mismatch"
-                        );
-
-                        const auto &el = arr[i];
-                        ptr[i] = el;
-                    }
-                }
-                else
-                {
-                    ptr = Allocator::allocate(stl::forward<Args>(args)...);
-                }
-
-                if constexpr (Concurrent)
-                {
-                    atomic_ref_count = ARefCountAllocator::allocate(1); // Allocate memory for atomic reference count
-                }
-                else
-                {
-                    ref_count = RefCountAllocator::allocate(); // Allocate memory for reference count
-                    *ref_count = 1; // Initialize reference count
                 }
             }
 
             shared_ptr(const nullptr_t _)
             noexcept {
                 // Initialize a null shared_ptr
-                ptr = nullptr;
-                ref_count = nullptr;
-                atomic_ref_count = nullptr;
+                block = nullptr;
             }
 
             shared_ptr(shared_ptr &&other) noexcept
-                : ref_count(other.ref_count), ptr(other.ptr), atomic_ref_count(other.atomic_ref_count)
+                : block(other.block)
             {
-                other.ptr = nullptr;
-                other.ref_count = nullptr;
-                other.atomic_ref_count = nullptr;
+                other.block = nullptr;
             }
 
             shared_ptr(const shared_ptr &other) noexcept
-                : ref_count(other.ref_count), ptr(other.ptr), atomic_ref_count(other.atomic_ref_count)
+                : block(other.block)
             {
                 add_ref_count();
             }
 
             shared_ptr(shared_ptr &other) noexcept
-                : ref_count(other.ref_count), ptr(other.ptr), atomic_ref_count(other.atomic_ref_count)
+                : block(other.block)
             {
                 add_ref_count();
             }
@@ -189,27 +192,9 @@ namespace zelix::stl
             {
                 if (this != &other)
                 {
-                    // Decrement current reference count
-                    if constexpr (Concurrent)
-                    {
-                        if (atomic_ref_count && --(*atomic_ref_count) == 0)
-                        {
-                            destroy();
-                        }
-                    }
-                    else
-                    {
-                        if (ref_count && --(*ref_count) == 0)
-                        {
-                            destroy();
-                        }
-                    }
-
-                    // Transfer ownership from other
-                    ref_count = other.ref_count;
-                    ptr = other.ptr;
-                    atomic_ref_count = other.atomic_ref_count;
-                    add_ref_count();
+                    other.add_ref_count(); // Before releasing, other may be owned by our object
+                    release();
+                    block = other.block;
                 }
 
                 return *this;
@@ -219,74 +204,212 @@ namespace zelix::stl
             {
                 if (this != &other)
                 {
-                    // Decrement current reference count
-                    if constexpr (Concurrent)
-                    {
-                        if (atomic_ref_count && --(*atomic_ref_count) == 0)
-                            destroy();
-                    }
-                    else
-                    {
-                        if (ref_count && --(*ref_count) == 0)
-                            destroy();
-                    }
+                    release();
 
                     // Steal from other
-                    ptr = other.ptr;
-                    ref_count = other.ref_count;
-                    atomic_ref_count = other.atomic_ref_count;
-
-                    // Nullify other
-                    other.ptr = nullptr;
-                    other.ref_count = nullptr;
-                    other.atomic_ref_count = nullptr;
+                    block = other.block;
+                    other.block = nullptr;
                 }
                 return *this;
             }
 
             T *operator->() const
             {
-                return ptr; // Access the managed object
+                return block ? &block->value : nullptr; // Access the managed object
             }
 
             bool operator==(const shared_ptr &other) const
             {
-                if (ptr == nullptr && other.ptr == nullptr)
+                if (block == nullptr && other.block == nullptr)
                     return true; // Both are null pointers
 
-                if (ptr == nullptr || other.ptr == nullptr)
+                if (block == nullptr || other.block == nullptr)
                     return false; // One is null, the other is not
 
-                return *ptr == *other.ptr; // Compare the managed objects
+                return block->value == other.block->value; // Compare the managed objects
             }
 
             T *operator *() const
             {
-                return ptr; // Dereference to get the managed object
+                return block ? &block->value : nullptr; // Dereference to get the managed object
             }
 
-            ~shared_ptr()
+            /// Number of pointers sharing the object, 0 for a null pointer
+            [[nodiscard]] int use_count() const
             {
-                if (!ptr) return; // Nothing to do for null pointer
+                if (!block) return 0;
 
                 if constexpr (Concurrent)
                 {
-                    if (atomic_ref_count && --(*atomic_ref_count) == 0)
-                    {
-                        destroy();
-                    }
+                    return block->count.load(std::memory_order_relaxed);
                 }
                 else
                 {
-                    if (ref_count && --(*ref_count) == 0)
-                    {
-                        destroy();
-                    }
+                    return block->count;
                 }
             }
+
+            ~shared_ptr()
+            {
+                release();
+            }
+        };
+
+        /**
+         * @brief Base for types that embed their own reference count.
+         *
+         * Derive from it to manage the type through intrusive_ptr, which then
+         * needs no control block at all.
+         *
+         * @tparam Concurrent Whether the count is atomic.
+         */
+        template <bool Concurrent>
+        class ref_counted
+        {
+            template <typename, bool, typename, typename>
+            friend class intrusive_ptr;
+
+            mutable __ref_count_t<Concurrent> ref_count_ = 1;
+
+        protected:
+            ref_counted() = default;
+            ref_counted(const ref_counted &) {} // Copies start with their own count
+            ref_counted &operator=(const ref_counted &) { return *this; }
+            ~ref_counted() = default;
+        };
+
+        /**
+         * @brief Reference-counted pointer to a type deriving from ref_counted.
+         *
+         * The count is part of the object, so the handle is a single pointer
+         * and the object is the only allocation.
+         *
+         * @tparam T Managed type, derived from ref_counted<Concurrent>.
+         * @tparam Concurrent Whether the count is atomic.
+         * @tparam Allocator Allocator for the managed objects.
+         */
+        template <
+            typename T,
+            bool Concurrent,
+            typename Allocator = memory::monotonic_resource<T>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::resource<T>, Allocator>
+            >
+        >
+        class intrusive_ptr
+        {
+            static_assert(std::is_base_of_v<ref_counted<Concurrent>, T>,
+                "intrusive_ptr requires T to derive from ref_counted");
+
+            T *ptr = nullptr; ///< Pointer to the managed object
+
+            void release()
+            {
+                if (ptr && __ref_release<Concurrent>(static_cast<const ref_counted<Concurrent> *>(ptr)->ref_count_))
+                {
+                    Allocator::deallocate(ptr);
+                }
+
+                ptr = nullptr;
+            }
+
+            void add_ref_count()
+            const {
+                if (ptr)
+                {
+                    __ref_acquire<Concurrent>(static_cast<const ref_counted<Concurrent> *>(ptr)->ref_count_);
+                }
+            }
+        public:
+            template <typename ...Args>
+            intrusive_ptr(Args &&...args)
+                : ptr(Allocator::allocate(stl::forward<Args>(args)...))
+            {}
+
+            intrusive_ptr(const nullptr_t _)
+            noexcept {}
+
+            intrusive_ptr(intrusive_ptr &&other) noexcept
+                : ptr(other.ptr)
+            {
+                other.ptr = nullptr;
+            }
+
+            intrusive_ptr(const intrusive_ptr &other) noexcept
+                : ptr(other.ptr)
+            {
+                add_ref_count();
+            }
+
+            intrusive_ptr(intrusive_ptr &other) noexcept
+                : ptr(other.ptr)
+            {
+                add_ref_count();
+            }
+
+            intrusive_ptr &operator=(const intrusive_ptr &other) noexcept
+            {
+                if (this != &other)
+                {
+                    other.add_ref_count();
+                    release();
+                    ptr = other.ptr;
+                }
+
+                return *this;
+            }
+
+            intrusive_ptr &operator=(intrusive_ptr &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    ptr = other.ptr;
+                    other.ptr = nullptr;
+                }
+
+                return *this;
+            }
+
+            T *operator->() const
+            {
+                return ptr;
+            }
+
+            T *operator *() const
+            {
+                return ptr;
+            }
+
+            bool operator==(const intrusive_ptr &other) const
+            {
+                if (ptr == nullptr || other.ptr == nullptr)
+                    return ptr == other.ptr;
+
+                return *ptr == *other.ptr; // Compare the managed objects
+            }
+
+            ~intrusive_ptr()
+            {
+                release();
+            }
         };
     }
 
+    template <
+        typename T,
+        bool Concurrent,
+        bool ConcurrentAllocation,
+        typename Allocator,
+        typename E
+    >
+    struct is_trivially_relocatable<
+        pmr::shared_ptr<T, Concurrent, ConcurrentAllocation, Allocator, E>
+    > : std::true_type {};
+
+    template <typename T, bool Concurrent, typename Allocator, typename E>
+    struct is_trivially_relocatable<pmr::intrusive_ptr<T, Concurrent, Allocator, E>> : std::true_type {};
+
     template <typename T>
     using shared_ptr = pmr::shared_ptr<T, false, false>; ///< Non-concurrent shared pointer
 
@@ -298,4 +421,13 @@ namespace zelix::stl
 
     template <typename T>
     using concurrent_rc_ptr = pmr::shared_ptr<T, false, true>; ///< Concurrent shared pointer
+
+    template <bool Concurrent = false>
+    using ref_counted = pmr::ref_counted<Concurrent>;
+
+    template <typename T>
+    using intrusive_ptr = pmr::intrusive_ptr<T, false>; ///< Non-concurrent intrusive pointer
+
+    template <typename T>
+    using concurrent_intrusive_ptr = pmr::intrusive_ptr<T, true>; ///< Concurrent intrusive pointer
 }
\ No newline at end of file
@@ -0,0 +1,651 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+
+#include "span.h"
+#include "zelix/except/out_of_range.h"
+#include "zelix/memory/array_resource.h"
+#include "zelix/memory/system_resource.h"
+#include "zelix/move.h"
+#include "zelix/relocatable.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        /**
+         * @brief A vector that keeps its first N elements inside the object.
+         *
+         * Nothing is allocated until the vector grows past N elements, at
+         * which point everything spills to the Allocator and it behaves like
+         * vector from then on. Offers the same API as vector.
+         *
+         * @tparam T Type of elements stored.
+         * @tparam N Number of elements stored inline.
+         * @tparam GrowthFactor Factor by which the capacity grows once on the heap.
+         * @tparam Allocator Memory allocator used after spilling.
+         */
+        template <
+            typename T,
+            size_t N,
+            double GrowthFactor = 1.8,
+            typename Allocator = memory::system_array_resource<T>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<T>, Allocator>
+            >
+        >
+        class small_vector
+        {
+            static_assert(N > 0, "small_vector needs at least one inline element, use vector instead");
+            static_assert(GrowthFactor > 1.0, "Growth factor must be greater than 1.0");
+
+            T *data_;                 ///< Inline storage or the heap block
+            size_t size_ = 0;         ///< Number of elements currently stored.
+            size_t capacity_ = N;     ///< Current capacity of the storage.
+            alignas(T) unsigned char inline_[N * sizeof(T)]; ///< Storage for the first N elements
+
+            T *inline_data()
+            {
+                return reinterpret_cast<T *>(inline_);
+            }
+
+            [[nodiscard]] bool is_inline() const
+            {
+                return data_ == reinterpret_cast<const T *>(inline_);
+            }
+
+            /// Moves count elements from src into the unconstructed slots at dst
+            static void relocate(T *dst, T *src, const size_t count)
+            {
+                if constexpr (is_trivially_relocatable_v<T>)
+                {
+                    if (count != 0) memcpy(static_cast<void *>(dst), src, sizeof(T) * count);
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        new (&dst[i]) T(stl::move(src[i]));
+                        src[i].~T();
+                    }
+                }
+            }
+
+            /// Moves [from, size_) up to start at to; the caller adjusts size_
+            void shift_tail(const size_t from, const size_t to)
+            {
+                const size_t count = size_ - from;
+                if (count == 0 || from == to)
+                {
+                    return;
+                }
+
+                if constexpr (is_trivially_relocatable_v<T>)
+                {
+                    memmove(static_cast<void *>(data_ + to), data_ + from, sizeof(T) * count);
+                }
+                else
+                {
+                    for (size_t i = count; i-- > 0;)
+                    {
+                        new (&data_[to + i]) T(stl::move(data_[from + i]));
+                        data_[from + i].~T();
+                    }
+                }
+            }
+
+            /**
+             * @brief Moves the elements into storage for new_capacity elements.
+             * Spills to the heap, reallocates on the heap, or returns inline.
+             */
+            void set_capacity(const size_t new_capacity)
+            {
+                if (new_capacity <= N)
+                {
+                    if (is_inline())
+                    {
+                        return;
+                    }
+
+                    T *heap = data_;
+                    relocate(inline_data(), heap, size_);
+                    Allocator::deallocate(heap);
+                    data_ = inline_data();
+                    capacity_ = N;
+                    return;
+                }
+
+                if (is_inline())
+                {
+                    T *heap = Allocator::allocate(new_capacity);
+                    relocate(heap, data_, size_);
+                    data_ = heap;
+                }
+                else
+                {
+                    data_ = Allocator::reallocate(data_, size_, new_capacity);
+                }
+
+                capacity_ = new_capacity;
+            }
+
+            /// Makes room for extra more elements with a single reallocation
+            void grow_for(const size_t extra)
+            {
+                const size_t needed = size_ + extra;
+                if (needed <= capacity_)
+                {
+                    return;
+                }
+
+                size_t grown = static_cast<size_t>(capacity_ * GrowthFactor);
+                if (grown <= capacity_) grown = capacity_ + 1;
+                set_capacity(grown > needed ? grown : needed);
+            }
+
+            /// Destroys the elements in [from, size_)
+            void destroy_from(const size_t from)
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = from; i < size_; ++i)
+                    {
+                        data_[i].~T();
+                    }
+                }
+            }
+
+            /// Destroys every element and returns to the inline storage
+            void destroy()
+            {
+                destroy_from(0);
+                size_ = 0;
+
+                if (!is_inline())
+                {
+                    Allocator::deallocate(data_);
+                    data_ = inline_data();
+                    capacity_ = N;
+                }
+            }
+
+            /// Takes other's elements, leaving it empty and inline
+            void steal(small_vector &other)
+            {
+                if (other.is_inline())
+                {
+                    relocate(inline_data(), other.data_, other.size_);
+                    data_ = inline_data();
+                    capacity_ = N;
+                }
+                else
+                {
+                    data_ = other.data_;
+                    capacity_ = other.capacity_;
+                    other.data_ = other.inline_data();
+                    other.capacity_ = N;
+                }
+
+                size_ = other.size_;
+                other.size_ = 0;
+            }
+
+            void check_index(const size_t index) const
+            {
+#           if defined(__GNUC__) || defined(__clang__)
+                if (__builtin_expect(index >= size_, 0))
+#           else
+                if (index >= size_)
+#           endif
+                    throw except::out_of_range("Index out of range");
+            }
+
+        public:
+            small_vector()
+                : data_(inline_data())
+            {}
+
+            small_vector(std::initializer_list<T> init)
+                : data_(inline_data())
+            {
+                append(init.begin(), init.end());
+            }
+
+            small_vector(const small_vector &other)
+                : data_(inline_data())
+            {
+                append(other.begin(), other.end());
+            }
+
+            small_vector(small_vector &&other) noexcept
+                : data_(inline_data())
+            {
+                steal(other);
+            }
+
+            small_vector &operator=(const small_vector &other)
+            {
+                if (this != &other)
+                {
+                    clear();
+                    append(other.begin(), other.end());
+                }
+
+                return *this;
+            }
+
+            small_vector &operator=(small_vector &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    destroy();
+                    steal(other);
+                }
+
+                return *this;
+            }
+
+            /**
+             * @brief Appends a copy of the given element to the end of the vector.
+             *
+             * @param value Element to append.
+             */
+            template <class U = T>
+            void push_back(U &&value)
+            {
+                emplace_back(stl::forward<U>(value));
+            }
+
+            /**
+             * @brief Constructs an element in-place at the end of the vector.
+             *
+             * @tparam Args Argument types for T's constructor.
+             * @param args Arguments to forward to T's constructor.
+             */
+            template <typename... Args>
+            void emplace_back(Args&&... args)
+            {
+#           if defined(__GNUC__) || defined(__clang__)
+                if (__builtin_expect(size_ >= capacity_, 0))
+#           else
+                if (size_ >= capacity_)
+#           endif
+                {
+                    // args may refer into the buffer that growing releases
+                    T value(stl::forward<Args>(args)...);
+                    grow_for(1);
+                    new (&data_[size_]) T(stl::move(value));
+                    ++size_;
+                    return;
+                }
+
+                new (&data_[size_]) T(stl::forward<Args>(args)...);
+                ++size_;
+            }
+
+            /**
+             * @brief Constructs an element in-place at the end without checking capacity.
+             *
+             * @tparam Args Argument types for T's constructor.
+             * @param args Arguments to forward to T's constructor.
+             */
+            template <typename... Args>
+            void emplace_back_unchecked(Args&&... args)
+            {
+                new (&data_[size_]) T(stl::forward<Args>(args)...);
+                ++size_;
+            }
+
+            /**
+             * @brief Appends copies of the elements in [first, last).
+             *
+             * @param first Iterator to the first element to copy.
+             * @param last Iterator past the last element to copy.
+             */
+            template <typename It>
+            void append(It first, It last)
+            {
+                if constexpr (requires { last - first; })
+                {
+                    grow_for(static_cast<size_t>(last - first));
+                }
+
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+
+            /**
+             * @brief Appends copies of every element of range.
+             *
+             * @param range Anything with begin() and end(), not this vector.
+             */
+            template <typename Range>
+            void append_range(const Range &range)
+            {
+                append(range.begin(), range.end());
+            }
+
+            /**
+             * @brief Inserts copies of [first, last) before index pos.
+             *
+             * @param pos Index to insert at, at most size().
+             * @param first Iterator to the first element to copy.
+             * @param last Iterator past the last element to copy.
+             * @throws except::out_of_range If pos is past the end.
+             */
+            template <typename It>
+            void insert(const size_t pos, It first, It last)
+            {
+                if (pos > size_)
+                    throw except::out_of_range("Insert position out of range");
+
+                size_t n = 0;
+                if constexpr (requires { last - first; })
+                {
+                    n = static_cast<size_t>(last - first);
+                }
+                else
+                {
+                    for (It it = first; it != last; ++it)
+                    {
+                        ++n;
+                    }
+                }
+
+                if (n == 0)
+                {
+                    return;
+                }
+
+                grow_for(n);
+                shift_tail(pos, pos + n);
+                for (T *dst = data_ + pos; first != last; ++first, ++dst)
+                {
+                    new (dst) T(*first);
+                }
+
+                size_ += n;
+            }
+
+            /**
+             * @brief Inserts copies of every element of range before index pos.
+             *
+             * @param pos Index to insert at, at most size().
+             * @param range Anything with begin() and end(), not this vector.
+             * @throws except::out_of_range If pos is past the end.
+             */
+            template <typename Range>
+            void insert_range(const size_t pos, const Range &range)
+            {
+                insert(pos, range.begin(), range.end());
+            }
+
+            /**
+             * @brief Grows or shrinks the vector to n elements.
+             *
+             * @param n The new number of elements.
+             * @param value Element to copy into new slots.
+             */
+            void resize(const size_t n, const T &value)
+            {
+                if (n <= size_)
+                {
+                    destroy_from(n);
+                    size_ = n;
+                    return;
+                }
+
+                if (n > capacity_)
+                {
+                    // value may live in the buffer that growing releases
+                    const T copy(value);
+                    grow_for(n - size_);
+                    while (size_ < n)
+                    {
+                        new (&data_[size_++]) T(copy);
+                    }
+
+                    return;
+                }
+
+                while (size_ < n)
+                {
+                    new (&data_[size_++]) T(value);
+                }
+            }
+
+            /**
+             * @brief Grows or shrinks the vector to n elements, value-initializing new ones.
+             *
+             * @param n The new number of elements.
+             */
+            void resize(const size_t n)
+            {
+                resize(n, T());
+            }
+
+            /**
+             * @brief Removes the last element from the vector.
+             */
+            void pop_back()
+            {
+                if (size_ > 0)
+                {
+                    --size_;
+                    data_[size_].~T();
+                }
+            }
+
+            /**
+             * @brief Removes the last element from the vector and returns it by move.
+             *
+             * @return T The last element, moved from the vector.
+             * @note Use with caution: the destructor is not called for the removed element.
+             */
+            T pop_back_move()
+            {
+                --size_;
+                return stl::move(data_[size_]);
+            }
+
+            /**
+             * @brief Removes all elements, keeping the current storage.
+             */
+            void clear()
+            {
+                destroy_from(0);
+                size_ = 0;
+            }
+
+            T *begin()
+            {
+                return data_;
+            }
+
+            T *end()
+            {
+                return data_ + size_;
+            }
+
+            [[nodiscard]] const T *begin() const
+            {
+                return data_;
+            }
+
+            [[nodiscard]] const T *end() const
+            {
+                return data_ + size_;
+            }
+
+            /**
+             * @brief Accesses the element at the given index.
+             *
+             * @throws except::out_of_range If index is out of bounds.
+             * @note Unchecked when built with ZELIX_STL_UNCHECKED.
+             */
+            T &operator[](const size_t index)
+            {
+#           ifndef ZELIX_STL_UNCHECKED
+                check_index(index);
+#           endif
+                return data_[index];
+            }
+
+            /**
+             * @brief Accesses the element at the given index (const overload).
+             *
+             * @throws except::out_of_range If index is out of bounds.
+             * @note Unchecked when built with ZELIX_STL_UNCHECKED.
+             */
+            const T &operator[](const size_t index) const
+            {
+#           ifndef ZELIX_STL_UNCHECKED
+                check_index(index);
+#           endif
+                return data_[index];
+            }
+
+            /**
+             * @brief Returns a reference to the element at the specified index.
+             *
+             * @throws except::out_of_range If the index is out of range.
+             */
+            T &ref_at(const size_t index)
+            {
+                check_index(index);
+                return data_[index];
+            }
+
+            T &unchecked_at(const size_t index)
+            {
+                return data_[index];
+            }
+
+            [[nodiscard]] const T &unchecked_at(const size_t index) const
+            {
+                return data_[index];
+            }
+
+            /**
+             * @brief Returns a reference to the last element in the vector.
+             * @throws except::out_of_range If the vector is empty.
+             */
+            T &back()
+            {
+                if (size_ == 0) throw except::out_of_range("back() on empty vector");
+                return data_[size_ - 1];
+            }
+
+            T *ptr()
+            {
+                return data_;
+            }
+
+            T *data()
+            {
+                return data_;
+            }
+
+            [[nodiscard]] const T *data() const
+            {
+                return data_;
+            }
+
+            span<T> view()
+            {
+                return {data_, size_};
+            }
+
+            [[nodiscard]] span<const T> view() const
+            {
+                return {data_, size_};
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return size_;
+            }
+
+            [[nodiscard]] size_t capacity() const
+            {
+                return capacity_;
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return size_ == 0;
+            }
+
+            /// Whether the elements currently live in the inline storage
+            [[nodiscard]] bool inlined() const
+            {
+                return is_inline();
+            }
+
+            /**
+             * @brief Reserves capacity for at least new_capacity elements.
+             * @param new_capacity The minimum capacity to reserve.
+             */
+            void reserve(const size_t new_capacity)
+            {
+                if (new_capacity > capacity_)
+                {
+                    set_capacity(new_capacity);
+                }
+            }
+
+            /**
+             * @brief Shrinks the capacity to fit the current size,
+             * moving back inline when the elements fit.
+             */
+            void shrink_to_fit()
+            {
+                if (size_ < capacity_ && !is_inline())
+                {
+                    set_capacity(size_);
+                }
+            }
+
+            ~small_vector()
+            {
+                destroy();
+            }
+        };
+    }
+
+    template <typename T, size_t N, double GrowthFactor = 1.8>
+    using small_vector = pmr::small_vector<T, N, GrowthFactor, memory::system_array_resource<T>>;
+}
@@ -0,0 +1,134 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstddef>
+
+namespace zelix::stl
+{
+    /**
+     * \brief A non-owning view over a contiguous run of elements.
+     *
+     * Just a pointer and a length with unchecked indexing, so loops over it
+     * compile to plain loads the optimizer can vectorize. Only valid while
+     * the storage it was taken from is neither freed nor reallocated.
+     *
+     * \tparam T Element type, const-qualified for read-only views.
+     */
+    template <typename T>
+    class span
+    {
+        T *data_ = nullptr;
+        size_t size_ = 0;
+
+    public:
+        constexpr span() = default;
+
+        constexpr span(T *data, const size_t size)
+            : data_(data), size_(size)
+        {}
+
+        constexpr span(T *begin, T *end)
+            : data_(begin), size_(static_cast<size_t>(end - begin))
+        {}
+
+        template <size_t N>
+        constexpr span(T (&array)[N]) // NOLINT(*-explicit-constructor)
+            : data_(array), size_(N)
+        {}
+
+        /// Allows passing a span<T> where a span<const T> is expected
+        constexpr operator span<const T>() const // NOLINT(*-explicit-constructor)
+        {
+            return {data_, size_};
+        }
+
+        constexpr T &operator[](const size_t index) const
+        {
+            return data_[index];
+        }
+
+        [[nodiscard]] constexpr T *data() const
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr size_t size() const
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        constexpr T *begin() const
+        {
+            return data_;
+        }
+
+        constexpr T *end() const
+        {
+            return data_ + size_;
+        }
+
+        constexpr T &front() const
+        {
+            return data_[0];
+        }
+
+        constexpr T &back() const
+        {
+            return data_[size_ - 1];
+        }
+
+        /// The count elements starting at offset; the range must be in bounds
+        [[nodiscard]] constexpr span subspan(const size_t offset, const size_t count) const
+        {
+            return {data_ + offset, count};
+        }
+
+        /// Everything from offset to the end
+        [[nodiscard]] constexpr span subspan(const size_t offset) const
+        {
+            return {data_ + offset, size_ - offset};
+        }
+
+        [[nodiscard]] constexpr span first(const size_t count) const
+        {
+            return {data_, count};
+        }
+
+        [[nodiscard]] constexpr span last(const size_t count) const
+        {
+            return {data_ + size_ - count, count};
+        }
+    };
+}
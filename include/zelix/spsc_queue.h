@@ -0,0 +1,269 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+#include "forward.h"
+#include "move.h"
+#include "zelix/memory/system_resource.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        /**
+         * \brief Bounded single-producer single-consumer queue.
+         *
+         * The producer owns tail_ and the consumer owns head_; each side keeps
+         * its own cached copy of the other's index on its cache line and only
+         * reloads it when the queue looks full (or empty). Exactly one thread
+         * may push and exactly one thread may pop at a time.
+         *
+         * \tparam T       Type of elements stored.
+         * \tparam Max     Capacity of the queue, must be a power of two.
+         * \tparam UseHeap Whether the slots are allocated on the heap or stored inline.
+         */
+        template <
+            typename T,
+            size_t Max,
+            bool UseHeap,
+            typename Allocator = memory::system_array_resource<T>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::array_resource<T>, Allocator>
+            >
+        >
+        class spsc_queue
+        {
+            static_assert(Max > 0 && (Max & (Max - 1)) == 0, "Queue capacity must be a power of two");
+            static constexpr size_t mask = Max - 1;
+
+            using data_type = std::conditional_t<
+                UseHeap,
+                T*,                                     // heap allocation
+                unsigned char[Max * sizeof(T)]          // inline raw storage
+            >;
+
+            alignas(64) std::atomic<size_t> head_ = 0; ///< Next slot to pop, written by the consumer
+            size_t cached_tail_ = 0; ///< Consumer's last view of tail_
+
+            alignas(64) std::atomic<size_t> tail_ = 0; ///< Next slot to push, written by the producer
+            size_t cached_head_ = 0; ///< Producer's last view of head_
+
+            alignas(64) alignas(T) data_type data;
+
+            T *slots()
+            {
+                if constexpr (UseHeap)
+                {
+                    return data;
+                }
+                else
+                {
+                    return reinterpret_cast<T *>(data);
+                }
+            }
+
+            /// Number of free slots seen by the producer, reloading head_ only when needed
+            size_t free_slots(const size_t tail, const size_t wanted)
+            {
+                size_t free = Max - (tail - cached_head_);
+                if (free < wanted)
+                {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                    free = Max - (tail - cached_head_);
+                }
+
+                return free;
+            }
+
+            /// Number of ready elements seen by the consumer, reloading tail_ only when needed
+            size_t ready_slots(const size_t head, const size_t wanted)
+            {
+                size_t ready = cached_tail_ - head;
+                if (ready < wanted)
+                {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                    ready = cached_tail_ - head;
+                }
+
+                return ready;
+            }
+
+        public:
+            spsc_queue()
+            {
+                if constexpr (UseHeap)
+                {
+                    data = Allocator::allocate(Max);
+                }
+            }
+
+            spsc_queue(const spsc_queue &) = delete;
+            spsc_queue &operator=(const spsc_queue &) = delete;
+
+            /**
+             * \brief Constructs an element at the back of the queue.
+             *
+             * \param args Arguments to forward to T's constructor.
+             * \return false if the queue is full.
+             */
+            template <typename... Args>
+            bool try_emplace(Args&&... args)
+            {
+                const size_t tail = tail_.load(std::memory_order_relaxed);
+                if (free_slots(tail, 1) == 0)
+                {
+                    return false;
+                }
+
+                new (&slots()[tail & mask]) T(stl::forward<Args>(args)...);
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * \brief Pushes an element to the back of the queue.
+             *
+             * \param value The element to push.
+             * \return false if the queue is full.
+             */
+            template <class U = T>
+            bool try_push(U &&value)
+            {
+                return try_emplace(stl::forward<U>(value));
+            }
+
+            /**
+             * \brief Pushes up to count elements, publishing them all at once.
+             *
+             * \param items Elements to copy into the queue.
+             * \param count Number of elements in items.
+             * \return The number of elements pushed.
+             */
+            size_t try_push_n(const T *items, const size_t count)
+            {
+                const size_t tail = tail_.load(std::memory_order_relaxed);
+                const size_t free = free_slots(tail, count);
+                const size_t n = free < count ? free : count;
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    new (&slots()[(tail + i) & mask]) T(items[i]);
+                }
+
+                if (n != 0) tail_.store(tail + n, std::memory_order_release);
+                return n;
+            }
+
+            /**
+             * \brief Pops the element at the front of the queue.
+             *
+             * \param out Receives the popped element.
+             * \return false if the queue is empty.
+             */
+            bool try_pop(T &out)
+            {
+                const size_t head = head_.load(std::memory_order_relaxed);
+                if (ready_slots(head, 1) == 0)
+                {
+                    return false;
+                }
+
+                T &slot = slots()[head & mask];
+                out = stl::move(slot);
+                slot.~T();
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * \brief Pops up to count elements, releasing their slots all at once.
+             *
+             * \param out Receives the popped elements.
+             * \param count Maximum number of elements to pop.
+             * \return The number of elements popped.
+             */
+            size_t try_pop_n(T *out, const size_t count)
+            {
+                const size_t head = head_.load(std::memory_order_relaxed);
+                const size_t ready = ready_slots(head, count);
+                const size_t n = ready < count ? ready : count;
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    T &slot = slots()[(head + i) & mask];
+                    out[i] = stl::move(slot);
+                    slot.~T();
+                }
+
+                if (n != 0) head_.store(head + n, std::memory_order_release);
+                return n;
+            }
+
+            /// Approximate number of queued elements; exact when called by either endpoint while the other is idle
+            [[nodiscard]] size_t size() const
+            {
+                return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] bool empty() const
+            {
+                return size() == 0;
+            }
+
+            [[nodiscard]] static constexpr size_t capacity()
+            {
+                return Max;
+            }
+
+            ~spsc_queue()
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    const size_t tail = tail_.load(std::memory_order_relaxed);
+                    for (size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+                    {
+                        slots()[i & mask].~T();
+                    }
+                }
+
+                if constexpr (UseHeap)
+                {
+                    Allocator::deallocate(data);
+                }
+            }
+        };
+    }
+
+    template <typename T, size_t Max, bool UseHeap>
+    using spsc_queue = pmr::spsc_queue<T, Max, UseHeap>;
+}
@@ -28,20 +28,24 @@
 //
 
 #pragma once
-#include "zelix/memory/allocator.h"
+#include "unrolled_list.h"
 
 namespace zelix::stl
 {
     namespace pmr
     {
+        /// Unrolled list with the default node capacity, shaped to fit the Container parameter
+        template <typename T, typename... Allocator>
+        using __stack_container = unrolled_list<T, __unrolled_default_capacity<T>, Allocator...>;
+
         template <
             typename T,
-            template <typename, typename...> class Container = delist,
+            template <typename, typename...> class Container = __stack_container,
             typename... ContainerArgs
         >
         class stack
         {
-            Container<T, ContainerArgs...> list; ///< Underlying delist to hold the stack elements
+            Container<T, ContainerArgs...> list; ///< Underlying list to hold the stack elements
         public:
             void push(const T& val)
             {
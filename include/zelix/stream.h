@@ -28,6 +28,9 @@
 //
 
 #pragma once
+#include <type_traits>
+
+#include "span.h"
 #include "zelix/vector.h"
 #include "zelix/optional.h"
 
@@ -48,6 +51,19 @@ namespace zelix::stl
         {
             vector<T, GrowthFactor, InitialCapacity, Allocator> data_; ///< Vector to hold the stream data
             size_t pos_ = 0; ///< Current position in the stream
+            optional<T> sentinel_ = default_sentinel(); ///< Returned by the *_ref accessors past the end
+
+            static optional<T> default_sentinel()
+            {
+                if constexpr (std::is_default_constructible_v<T>)
+                {
+                    return optional<T>::emplace();
+                }
+                else
+                {
+                    return optional<T>::none();
+                }
+            }
 
         public:
             explicit stream(vector<T>& data) :
@@ -56,6 +72,15 @@ namespace zelix::stl
             explicit stream(vector<T>&& data) :
                 data_(stl::move(data)) {}
 
+            /**
+             * @brief Constructs a stream whose *_ref accessors return sentinel past the end.
+             *
+             * @param data Elements of the stream.
+             * @param sentinel End-of-stream element, e.g. an EOF token.
+             */
+            stream(vector<T>&& data, T sentinel) :
+                data_(stl::move(data)), sentinel_(optional<T>::some(stl::move(sentinel))) {}
+
             /**
              * @brief Constructs an element in-place at the end of the vector.
              *
@@ -80,7 +105,7 @@ namespace zelix::stl
                     return optional<T>::none(); ///< Return nullopt if no more elements
                 }
 
-                return optional<T>::some(data_[pos_ + n]); ///< Return the next element without advancing
+                return optional<T>::emplace(data_.unchecked_at(pos_ + n)); ///< Return the next element without advancing
             }
 
             optional<T> peek()
@@ -95,7 +120,7 @@ namespace zelix::stl
                     return optional<T>::none(); ///< Return nullopt if no current element
                 }
 
-                return optional<T>::some(data_[pos_ - 1]); ///< Return the current element
+                return optional<T>::emplace(data_.unchecked_at(pos_ - 1)); ///< Return the current element
             }
 
             optional<T> next()
@@ -105,7 +130,83 @@ namespace zelix::stl
                     return optional<T>::none(); ///< Return nullopt if no more elements
                 }
 
-                return optional<T>::some(data_[pos_++]); ///< Return the next element and advance the position
+                return optional<T>::emplace(data_.unchecked_at(pos_++)); ///< Return the next element and advance the position
+            }
+
+            /**
+             * @brief Returns the element n positions ahead without copying it.
+             *
+             * @return The element, or the sentinel past the end.
+             * @throws except::exception If past the end and the stream has no sentinel.
+             */
+            const T &peek_ref(const size_t n = 0)
+            {
+                if (pos_ + n >= data_.size())
+                {
+                    return sentinel_.get();
+                }
+
+                return data_.unchecked_at(pos_ + n);
+            }
+
+            /**
+             * @brief Returns the last consumed element without copying it.
+             *
+             * @return The element, or the sentinel if nothing was consumed yet.
+             * @throws except::exception If there is no current element and the stream has no sentinel.
+             */
+            const T &curr_ref()
+            {
+                if (pos_ == 0 || pos_ > data_.size())
+                {
+                    return sentinel_.get();
+                }
+
+                return data_.unchecked_at(pos_ - 1);
+            }
+
+            /**
+             * @brief Returns the next element without copying it and advances past it.
+             *
+             * @return The element, or the sentinel (without advancing) at the end.
+             * @throws except::exception If at the end and the stream has no sentinel.
+             */
+            const T &next_ref()
+            {
+                if (pos_ >= data_.size())
+                {
+                    return sentinel_.get();
+                }
+
+                return data_.unchecked_at(pos_++);
+            }
+
+            /**
+             * @brief Whether ref is the end-of-stream sentinel returned by the *_ref accessors.
+             */
+            [[nodiscard]] bool is_end(const T &ref) const
+            {
+                return sentinel_.is_some() && &ref == &sentinel_.get();
+            }
+
+            /**
+             * @brief Views the next n elements (fewer near the end) and advances past them.
+             */
+            span<const T> take(const size_t n)
+            {
+                const size_t left = pos_ < data_.size() ? data_.size() - pos_ : 0;
+                const size_t count = n < left ? n : left;
+                const span<const T> view(data_.data() + pos_, count);
+                pos_ += count;
+                return view;
+            }
+
+            /**
+             * @brief Whether every element has been consumed.
+             */
+            [[nodiscard]] bool at_end() const
+            {
+                return pos_ >= data_.size();
             }
 
 		    vector<T> &ptr()
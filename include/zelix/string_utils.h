@@ -54,6 +54,33 @@
 #   include <cstring> // Fallback to standard library
 #endif
 
+// The chain above only picks the widest header available, derive
+// which instruction sets the compiler is actually allowed to emit
+#if defined(ZELIX_STL_USE_SIMD)
+#   if defined(ZELIX_STL_AVX_DEF) && defined(__AVX2__)
+#       define ZELIX_STL_AVX2_AVAILABLE
+#   endif
+#   if (defined(ZELIX_STL_AVX_DEF) || defined(ZELIX_STL_SSE4_1_DEF) || \
+    defined(ZELIX_STL_SSSE3_DEF) || defined(ZELIX_STL_SSE2_DEF)) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#       define ZELIX_STL_SSE2_AVAILABLE
+#   endif
+    // GCC and Clang can emit AVX2 for a single function without -mavx2, so on
+    // x86 the string kernels are picked from CPUID at runtime instead
+#   if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#       define ZELIX_STL_X86_DISPATCH
+#       include <immintrin.h>
+#   endif
+#   if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#       define ZELIX_STL_NEON_DEF
+#       include <arm_neon.h>
+#   endif
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
 namespace zelix::stl::str
 {
     /**
@@ -90,133 +117,533 @@ namespace zelix::stl::str
         return true; // Return true
     }
 
-    template <bool FallbackLibc=false>
-    static inline size_t len(const char *str)
+    inline constexpr size_t npos = static_cast<size_t>(-1); ///< Returned by the search kernels when nothing matches
+
+    // Vector loops below only run for full in-bounds blocks, but GCC cannot prove
+    // that for small arrays once the length is opaque and flags the dead loads
+#   if defined(__GNUC__) && !defined(__clang__)
+#       pragma GCC diagnostic push
+#       pragma GCC diagnostic ignored "-Warray-bounds"
+#   endif
+
+#   ifdef ZELIX_STL_NEON_DEF
+    /// Narrows a byte-wise comparison into a 64-bit mask with 4 bits per byte
+    static inline uint64_t __neon_mask(const uint8x16_t eq)
     {
-#   ifdef ZELIX_STL_AVX_DEF
-        const char *s = str;
-        const char *start = str;
+        const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+#   endif
+
+    /// Scalar fallback for `len_bounded`, reads at most `max` bytes
+    static inline size_t __len_scalar(const char *str, const size_t max)
+    {
+        size_t i = 0;
+        while (i < max && str[i] != '\0')
+        {
+            i++;
+        }
+
+        return i;
+    }
+
+    // The vector kernels below only issue loads aligned to their own width. An
+    // aligned block never straddles a page, so touching the bytes around the
+    // string (before it, or past the terminator) can never fault, but the
+    // sanitizers cannot tell the difference and have to be kept out of them
+#   if defined(__GNUC__) || defined(__clang__)
+#       define ZELIX_STL_PAGE_SAFE_KERNEL __attribute__((no_sanitize("address", "thread")))
+#   else
+#       define ZELIX_STL_PAGE_SAFE_KERNEL
+#   endif
+
+#   ifdef ZELIX_STL_X86_DISPATCH
+#       define ZELIX_STL_TARGET(isa) __attribute__((target(isa)))
+#   else
+#       define ZELIX_STL_TARGET(isa)
+#   endif
 
-        // Load in 32-byte chunks (AVX2 supports this)
-        while (true) {
-            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
+#   if defined(ZELIX_STL_X86_DISPATCH) || defined(ZELIX_STL_SSE2_AVAILABLE)
+    ZELIX_STL_PAGE_SAFE_KERNEL ZELIX_STL_TARGET("sse2")
+    static inline size_t __len_sse2(const char *str, const size_t max)
+    {
+        if (max == 0) return 0;
 
-            // Compare against zero
-            const __m256i cmp = _mm256_cmpeq_epi8(chunk, _mm256_setzero_si256());
+        const auto addr = reinterpret_cast<uintptr_t>(str);
+        const size_t skip = addr & 15;
+        const char *block = str - skip;
+        const __m128i zero = _mm_setzero_si128();
 
-            // Move mask into an int
+        // The first block starts before `str`, drop the bytes that are not ours
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(block)), zero)
+        )) >> skip;
+        if (mask != 0)
+        {
+            const size_t found = __builtin_ctz(mask);
+            return found < max ? found : max;
+        }
 
-            if (
-                const unsigned int mask = _mm256_movemask_epi8(cmp);
-                mask != 0
-            ) {
-                // Found a null terminator
-                const int idx = __builtin_ctz(mask); // index of first zero
-                return s - start + idx;
+        for (block += 16; static_cast<size_t>(block - str) < max; block += 16)
+        {
+            mask = static_cast<uint32_t>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(block)), zero)
+            ));
+            if (mask != 0)
+            {
+                const size_t found = static_cast<size_t>(block - str) + __builtin_ctz(mask);
+                return found < max ? found : max;
             }
+        }
+
+        return max;
+    }
+#   endif
+
+#   if defined(ZELIX_STL_X86_DISPATCH) || defined(ZELIX_STL_AVX2_AVAILABLE)
+    ZELIX_STL_PAGE_SAFE_KERNEL ZELIX_STL_TARGET("avx2")
+    static inline size_t __len_avx2(const char *str, const size_t max)
+    {
+        if (max == 0) return 0;
 
-            s += 32;
+        const auto addr = reinterpret_cast<uintptr_t>(str);
+        const size_t skip = addr & 31;
+        const char *block = str - skip;
+        const __m256i zero = _mm256_setzero_si256();
+
+        // The first block starts before `str`, drop the bytes that are not ours
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i *>(block)), zero)
+        )) >> skip;
+        if (mask != 0)
+        {
+            const size_t found = __builtin_ctz(mask);
+            return found < max ? found : max;
         }
-#   elif defined(ZELIX_STL_SSE4_1_DEF)
-        const char *start = str;
-        __m128i zeros = _mm_setzero_si128();
 
-        // Align to 16 bytes
-        while (((uintptr_t)str & 0x0F) != 0) {
-            if (*str == '\0') return (size_t)(str - start);
-            str++;
+        for (block += 32; static_cast<size_t>(block - str) < max; block += 32)
+        {
+            mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i *>(block)), zero)
+            ));
+            if (mask != 0)
+            {
+                const size_t found = static_cast<size_t>(block - str) + __builtin_ctz(mask);
+                return found < max ? found : max;
+            }
         }
 
-        for (;;) {
-            __m128i chunk = _mm_load_si128((const __m128i *)str);
-            __m128i cmp   = _mm_cmpeq_epi8(chunk, zeros);
-            int mask      = _mm_movemask_epi8(cmp);
+        return max;
+    }
+#   endif
+
+#   ifdef ZELIX_STL_NEON_DEF
+    ZELIX_STL_PAGE_SAFE_KERNEL
+    static inline size_t __len_neon(const char *str, const size_t max)
+    {
+        if (max == 0) return 0;
+
+        const auto addr = reinterpret_cast<uintptr_t>(str);
+        const size_t skip = addr & 15;
+        const char *block = str - skip;
+
+        // 4 mask bits per byte, so the leading bytes are dropped 4 bits at a time
+        uint64_t mask = __neon_mask(vceqzq_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(block)))) >> (skip * 4);
+        if (mask != 0)
+        {
+            const size_t found = __builtin_ctzll(mask) >> 2;
+            return found < max ? found : max;
+        }
 
-            if (mask != 0) {
-                // Found a zero somewhere in the 16 bytes
-                int offset = __builtin_ctz(mask); // index of first set bit
-                return (size_t)(str - start + offset);
+        for (block += 16; static_cast<size_t>(block - str) < max; block += 16)
+        {
+            mask = __neon_mask(vceqzq_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(block))));
+            if (mask != 0)
+            {
+                const size_t found = static_cast<size_t>(block - str) + (__builtin_ctzll(mask) >> 2);
+                return found < max ? found : max;
             }
+        }
+
+        return max;
+    }
+#   endif
+
+#   ifdef ZELIX_STL_X86_DISPATCH
+    using __len_kernel = size_t (*)(const char *, size_t);
 
-            str += 16;
+    /// Picks the widest kernel the running CPU supports
+    static inline __len_kernel __len_select()
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return __len_avx2;
+        }
+
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return __len_sse2;
         }
-#   elif defined(ZELIX_STL_SSSE3_DEF)
-        const char *p = s;
-        __m128i zero = _mm_setzero_si128();
 
-        // scan 16 bytes at a time
-        while (1) {
-            __m128i chunk = _mm_loadu_si128((const __m128i*)p);
-            __m128i cmp   = _mm_cmpeq_epi8(chunk, zero);
-            int mask      = _mm_movemask_epi8(cmp);
+        return __len_scalar;
+    }
+
+    static inline size_t __len_dispatch(const char *str, const size_t max)
+    {
+        static const __len_kernel kernel = __len_select(); // Resolved on first use
+        return kernel(str, max);
+    }
+#   endif
+
+    /**
+     * Computes the length of `str`, reading at most `max` bytes of the string.
+     *
+     * The vector kernels only use aligned loads, so a string that ends right
+     * before an unmapped page is safe to scan. On x86 the kernel is chosen at
+     * runtime from CPUID, so a binary built without `-mavx2` still uses AVX2
+     * where the CPU has it and never executes it where it does not.
+     *
+     * \param str The string to measure.
+     * \param max The maximum number of bytes to examine.
+     * \return    The index of the null terminator, or `max` if none was found.
+     */
+    static inline size_t len_bounded(const char *str, const size_t max)
+    {
+#   if defined(ZELIX_STL_X86_DISPATCH)
+        return __len_dispatch(str, max);
+#   elif defined(ZELIX_STL_AVX2_AVAILABLE)
+        return __len_avx2(str, max);
+#   elif defined(ZELIX_STL_SSE2_AVAILABLE)
+        return __len_sse2(str, max);
+#   elif defined(ZELIX_STL_NEON_DEF)
+        return __len_neon(str, max);
+#   else
+        return __len_scalar(str, max);
+#   endif
+    }
+
+    /**
+     * Computes the length of a null-terminated string.
+     *
+     * \tparam FallbackLibc Use `strlen` when no vector kernel is available.
+     */
+    template <bool FallbackLibc=false>
+    static inline size_t len(const char *str)
+    {
+#   if defined(ZELIX_STL_X86_DISPATCH) || defined(ZELIX_STL_AVX2_AVAILABLE) || \
+    defined(ZELIX_STL_SSE2_AVAILABLE) || defined(ZELIX_STL_NEON_DEF)
+        return len_bounded(str, npos);
+#   else
+        if constexpr (FallbackLibc)
+        {
+            return strlen(str);
+        }
+        else
+        {
+            return __len_scalar(str, npos);
+        }
+#   endif
+    }
 
-            if (mask != 0) {
-                // found a zero byte
-                return (size_t)(p - s) + __builtin_ctz(mask);
+    /**
+     * Finds the first occurrence of `c` in the first `n` bytes of `s`.
+     *
+     * \return The index of the match, or `npos`.
+     */
+    static inline size_t find_char(const char *s, const size_t n, const char c)
+    {
+        size_t i = 0;
+#   ifdef ZELIX_STL_AVX2_AVAILABLE
+        const __m256i needle32 = _mm256_set1_epi8(c);
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+            if (const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle32))))
+            {
+                return i + __builtin_ctz(mask);
             }
-            p += 16;
         }
-#   elif defined(ZELIX_STL_SSE2_DEF)
-        const char *s = str;
-        __m128i zero = _mm_setzero_si128();
+#   endif
+#   ifdef ZELIX_STL_SSE2_AVAILABLE
+        const __m128i needle16 = _mm_set1_epi8(c);
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            if (const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle16)))
+            {
+                return i + __builtin_ctz(mask);
+            }
+        }
+#   elif defined(ZELIX_STL_NEON_DEF)
+        const uint8x16_t needle16 = vdupq_n_u8(static_cast<uint8_t>(c));
+        for (; i + 16 <= n; i += 16)
+        {
+            const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(s + i));
+            if (const uint64_t mask = __neon_mask(vceqq_u8(chunk, needle16)))
+            {
+                return i + (__builtin_ctzll(mask) >> 2);
+            }
+        }
+#   endif
+        for (; i < n; ++i)
+        {
+            if (s[i] == c) return i;
+        }
+
+        return npos;
+    }
 
-        // Align to 16 bytes
-        while (((uintptr_t)s & 0x0F) != 0) {
-            if (*s == '\0')
-                return (size_t)(s - str);
-            s++;
+    /**
+     * Counts the occurrences of `c` in the first `n` bytes of `s`.
+     */
+    static inline size_t count_char(const char *s, const size_t n, const char c)
+    {
+        size_t i = 0;
+        size_t count = 0;
+#   ifdef ZELIX_STL_AVX2_AVAILABLE
+        const __m256i needle32 = _mm256_set1_epi8(c);
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+            count += __builtin_popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle32))));
+        }
+#   endif
+#   ifdef ZELIX_STL_SSE2_AVAILABLE
+        const __m128i needle16 = _mm_set1_epi8(c);
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle16)));
+        }
+#   elif defined(ZELIX_STL_NEON_DEF)
+        const uint8x16_t needle16 = vdupq_n_u8(static_cast<uint8_t>(c));
+        for (; i + 16 <= n; i += 16)
+        {
+            const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(s + i));
+            count += __builtin_popcountll(__neon_mask(vceqq_u8(chunk, needle16))) >> 2;
+        }
+#   endif
+        for (; i < n; ++i)
+        {
+            count += s[i] == c;
         }
 
-        for (;;) {
-            __m128i chunk = _mm_load_si128((const __m128i *)s);
-            __m128i cmp = _mm_cmpeq_epi8(chunk, zero);
-            int mask = _mm_movemask_epi8(cmp);
+        return count;
+    }
 
-            if (mask != 0) {
-                // found a null byte
-                int offset = __builtin_ctz(mask);
-                return (size_t)((s - str) + offset);
+    /**
+     * Compares the first `n` bytes of `a` and `b`, like memcmp.
+     *
+     * \return Negative, zero or positive as `a` sorts before, equal to or after `b`.
+     */
+    static inline int compare(const char *a, const char *b, const size_t n)
+    {
+        size_t i = 0;
+#   ifdef ZELIX_STL_AVX2_AVAILABLE
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+            if (const auto diff = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y))))
+            {
+                const size_t j = i + __builtin_ctz(diff);
+                return static_cast<unsigned char>(a[j]) - static_cast<unsigned char>(b[j]);
+            }
+        }
+#   endif
+#   ifdef ZELIX_STL_SSE2_AVAILABLE
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+            if (const auto diff = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFF)
+            {
+                const size_t j = i + __builtin_ctz(diff);
+                return static_cast<unsigned char>(a[j]) - static_cast<unsigned char>(b[j]);
+            }
+        }
+#   elif defined(ZELIX_STL_NEON_DEF)
+        for (; i + 16 <= n; i += 16)
+        {
+            const uint8x16_t x = vld1q_u8(reinterpret_cast<const uint8_t *>(a + i));
+            const uint8x16_t y = vld1q_u8(reinterpret_cast<const uint8_t *>(b + i));
+            if (const uint64_t diff = ~__neon_mask(vceqq_u8(x, y)))
+            {
+                const size_t j = i + (__builtin_ctzll(diff) >> 2);
+                return static_cast<unsigned char>(a[j]) - static_cast<unsigned char>(b[j]);
             }
-            s += 16;
         }
-#   elif defined(ZELIX_STL_SSE_DEF)
-        const char *start = str;
-        // align pointer to 16-byte boundary
-        while (((uintptr_t)str & 15) != 0) {
-            if (*str == '\0')
-                return str - start;
-            str++;
+#   endif
+        for (; i < n; ++i)
+        {
+            if (a[i] != b[i])
+            {
+                return static_cast<unsigned char>(a[i]) - static_cast<unsigned char>(b[i]);
+            }
         }
 
-        // process 16 bytes at a time
-        const __m128i zeros = _mm_setzero_si128();
-        for (;;) {
-            __m128i chunk = _mm_load_si128((const __m128i*)str);
-            __m128i cmp   = _mm_cmpeq_epi8(chunk, zeros);
-            int mask      = _mm_movemask_epi8(cmp);
+        return 0;
+    }
 
-            if (mask != 0) { // found null terminator
-                int offset = __builtin_ctz(mask);
-                return (str - start) + offset;
+    /**
+     * Finds the first occurrence of `needle` (of length `m`) in the first `n` bytes of `hay`.
+     *
+     * Candidates are filtered by matching the first and last needle bytes a whole
+     * vector at a time; only positions where both match are verified.
+     *
+     * \return The index of the match, or `npos`. An empty needle matches at 0.
+     */
+    static inline size_t find(const char *hay, const size_t n, const char *needle, const size_t m)
+    {
+        if (m == 0) return 0;
+        if (m > n) return npos;
+        if (m == 1) return find_char(hay, n, needle[0]);
+
+        size_t i = 0;
+#   ifdef ZELIX_STL_AVX2_AVAILABLE
+        {
+            const __m256i first = _mm256_set1_epi8(needle[0]);
+            const __m256i last = _mm256_set1_epi8(needle[m - 1]);
+            for (; i + m - 1 + 32 <= n; i += 32)
+            {
+                const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i));
+                const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i + m - 1));
+                auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last))));
+
+                while (mask)
+                {
+                    const size_t j = i + __builtin_ctz(mask);
+                    if (memcmp(hay + j + 1, needle + 1, m - 2) == 0) return j;
+                    mask &= mask - 1;
+                }
             }
-            str += 16;
         }
-#   else
-        if constexpr (FallbackLibc)
+#   endif
+#   ifdef ZELIX_STL_SSE2_AVAILABLE
         {
-            return strlen(str);
+            const __m128i first = _mm_set1_epi8(needle[0]);
+            const __m128i last = _mm_set1_epi8(needle[m - 1]);
+            for (; i + m - 1 + 16 <= n; i += 16)
+            {
+                const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i));
+                const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i + m - 1));
+                auto mask = static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+
+                while (mask)
+                {
+                    const size_t j = i + __builtin_ctz(mask);
+                    if (memcmp(hay + j + 1, needle + 1, m - 2) == 0) return j;
+                    mask &= mask - 1;
+                }
+            }
         }
-        else
+#   elif defined(ZELIX_STL_NEON_DEF)
         {
-            const char *s = str;
-            const char *start = s;
+            const uint8x16_t first = vdupq_n_u8(static_cast<uint8_t>(needle[0]));
+            const uint8x16_t last = vdupq_n_u8(static_cast<uint8_t>(needle[m - 1]));
+            for (; i + m - 1 + 16 <= n; i += 16)
+            {
+                const uint8x16_t head = vld1q_u8(reinterpret_cast<const uint8_t *>(hay + i));
+                const uint8x16_t tail = vld1q_u8(reinterpret_cast<const uint8_t *>(hay + i + m - 1));
+                uint64_t mask = __neon_mask(vandq_u8(vceqq_u8(head, first), vceqq_u8(tail, last)))
+                    & 0x1111111111111111ull; // One bit per byte
 
-            while (*s) {
-                s++;
+                while (mask)
+                {
+                    const size_t j = i + (__builtin_ctzll(mask) >> 2);
+                    if (memcmp(hay + j + 1, needle + 1, m - 2) == 0) return j;
+                    mask &= mask - 1;
+                }
             }
+        }
+#   endif
+        for (; i + m <= n; ++i)
+        {
+            if (hay[i] == needle[0] && memcmp(hay + i + 1, needle + 1, m - 1) == 0) return i;
+        }
+
+        return npos;
+    }
 
-            return s - start;
+    /**
+     * Folds ASCII uppercase letters to lowercase; other bytes are left untouched.
+     */
+    static constexpr char to_lower_ascii(const char c)
+    {
+        return static_cast<char>(c + (static_cast<unsigned char>(c - 'A') < 26 ? 'a' - 'A' : 0));
+    }
+
+    /**
+     * Writes the ASCII-lowercased first `n` bytes of `src` to `dst` (which may equal `src`).
+     */
+    static inline void to_lower_ascii(char *dst, const char *src, const size_t n)
+    {
+        size_t i = 0;
+#   ifdef ZELIX_STL_AVX2_AVAILABLE
+        {
+            const __m256i below = _mm256_set1_epi8('A' - 1);
+            const __m256i above = _mm256_set1_epi8('Z' + 1);
+            const __m256i delta = _mm256_set1_epi8('a' - 'A');
+            for (; i + 32 <= n; i += 32)
+            {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(x, below), _mm256_cmpgt_epi8(above, x));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                                    _mm256_add_epi8(x, _mm256_and_si256(upper, delta)));
+            }
+        }
+#   endif
+#   ifdef ZELIX_STL_SSE2_AVAILABLE
+        {
+            const __m128i below = _mm_set1_epi8('A' - 1);
+            const __m128i above = _mm_set1_epi8('Z' + 1);
+            const __m128i delta = _mm_set1_epi8('a' - 'A');
+            for (; i + 16 <= n; i += 16)
+            {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, below), _mm_cmpgt_epi8(above, x));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_add_epi8(x, _mm_and_si128(upper, delta)));
+            }
+        }
+#   elif defined(ZELIX_STL_NEON_DEF)
+        {
+            const uint8x16_t lo = vdupq_n_u8('A');
+            const uint8x16_t hi = vdupq_n_u8('Z');
+            const uint8x16_t delta = vdupq_n_u8('a' - 'A');
+            for (; i + 16 <= n; i += 16)
+            {
+                const uint8x16_t x = vld1q_u8(reinterpret_cast<const uint8_t *>(src + i));
+                const uint8x16_t upper = vandq_u8(vcgeq_u8(x, lo), vcleq_u8(x, hi));
+                vst1q_u8(reinterpret_cast<uint8_t *>(dst + i), vaddq_u8(x, vandq_u8(upper, delta)));
+            }
+        }
+#   endif
+        for (; i < n; ++i)
+        {
+            dst[i] = to_lower_ascii(src[i]);
         }
-#       endif
     }
+
+    /**
+     * Checks whether the first `n` bytes of `s` start with the `m` bytes of `prefix`.
+     */
+    static inline bool starts_with(const char *s, const size_t n, const char *prefix, const size_t m)
+    {
+        return m <= n && compare(s, prefix, m) == 0;
+    }
+
+    /**
+     * Checks whether the first `n` bytes of `s` end with the `m` bytes of `suffix`.
+     */
+    static inline bool ends_with(const char *s, const size_t n, const char *suffix, const size_t m)
+    {
+        return m <= n && compare(s + n - m, suffix, m) == 0;
+    }
+
+#   if defined(__GNUC__) && !defined(__clang__)
+#       pragma GCC diagnostic pop
+#   endif
 }
\ No newline at end of file
@@ -0,0 +1,476 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include "move.h"
+#include "vector.h"
+
+namespace zelix::stl
+{
+    /// Unit of work run by thread_pool; execute() owns and releases the task
+    struct __pool_task
+    {
+        void (*execute)(__pool_task *);
+    };
+
+    /**
+     * \brief Chase-Lev work-stealing deque of tasks.
+     *
+     * Only the owning worker pushes and takes at the bottom; any thread may
+     * steal from the top. The ring grows when full and retired rings are
+     * kept until the deque dies, since a thief may still be reading one.
+     */
+    class __steal_deque
+    {
+        struct ring
+        {
+            int64_t capacity;
+            std::atomic<__pool_task *> *slots;
+            ring *retired; ///< Previous (smaller) ring, freed with the deque
+
+            explicit ring(const int64_t cap, ring *prev)
+                : capacity(cap), slots(new std::atomic<__pool_task *>[cap]), retired(prev)
+            {}
+
+            [[nodiscard]] __pool_task *get(const int64_t i) const
+            {
+                return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+            }
+
+            void put(const int64_t i, __pool_task *task)
+            {
+                slots[i & (capacity - 1)].store(task, std::memory_order_relaxed);
+            }
+
+            ~ring()
+            {
+                delete[] slots;
+            }
+        };
+
+        alignas(64) std::atomic<int64_t> top_ = 0;
+        alignas(64) std::atomic<int64_t> bottom_ = 0;
+        std::atomic<ring *> ring_ = new ring(256, nullptr);
+
+    public:
+        __steal_deque() = default;
+        __steal_deque(const __steal_deque &) = delete;
+        __steal_deque &operator=(const __steal_deque &) = delete;
+
+        /// Owner only
+        void push(__pool_task *task)
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed);
+            const int64_t t = top_.load(std::memory_order_acquire);
+            ring *r = ring_.load(std::memory_order_relaxed);
+
+            if (b - t > r->capacity - 1)
+            {
+                auto *grown = new ring(r->capacity * 2, r);
+                for (int64_t i = t; i < b; ++i) grown->put(i, r->get(i));
+                ring_.store(grown, std::memory_order_release);
+                r = grown;
+            }
+
+            r->put(b, task);
+            bottom_.store(b + 1, std::memory_order_release);
+        }
+
+        /// Owner only; returns nullptr when empty
+        __pool_task *take()
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            ring *r = ring_.load(std::memory_order_relaxed);
+
+            // seq_cst store/load pair orders this against a thief's top/bottom reads
+            bottom_.store(b, std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_seq_cst);
+
+            if (t > b)
+            {
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            __pool_task *task = r->get(b);
+            if (t == b)
+            {
+                // Last element, race the thieves for it
+                if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+
+            return task;
+        }
+
+        /// Any thread; returns nullptr when empty or when another thread won the race
+        __pool_task *steal()
+        {
+            int64_t t = top_.load(std::memory_order_seq_cst);
+            const int64_t b = bottom_.load(std::memory_order_seq_cst);
+            if (t >= b) return nullptr;
+
+            const ring *r = ring_.load(std::memory_order_acquire);
+            __pool_task *task = r->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+
+            return task;
+        }
+
+        ~__steal_deque()
+        {
+            ring *r = ring_.load(std::memory_order_relaxed);
+            while (r)
+            {
+                ring *prev = r->retired;
+                delete r;
+                r = prev;
+            }
+        }
+    };
+
+    /**
+     * \brief Work-stealing thread pool.
+     *
+     * Every worker has its own __steal_deque: tasks spawned on a worker go to
+     * its bottom and idle workers steal from the top of the others. Tasks
+     * submitted from outside the pool go through a shared injection queue.
+     * Threads waiting on a task_group run pending tasks instead of blocking,
+     * so nested parallel sections cannot deadlock.
+     *
+     * thread_pool::global() is a process-wide pool meant to be shared by
+     * everything in the library that wants background threads.
+     */
+    class thread_pool
+    {
+        struct worker
+        {
+            __steal_deque deque;
+            uint64_t seed; ///< xorshift state for picking victims
+        };
+
+        vector<worker *> workers_;
+        vector<std::thread> threads_;
+        vector<__pool_task *> injected_; ///< Tasks submitted from outside the pool
+        std::mutex injected_mutex_;
+
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        alignas(64) std::atomic<size_t> pending_ = 0; ///< Tasks queued but not yet picked up
+        std::atomic<size_t> sleeping_ = 0;
+        std::atomic<bool> stop_ = false;
+
+        struct current_worker
+        {
+            thread_pool *pool;
+            worker *self;
+        };
+
+        static current_worker &current()
+        {
+            static thread_local current_worker cur{nullptr, nullptr};
+            return cur;
+        }
+
+        worker *local_worker()
+        {
+            const current_worker &cur = current();
+            return cur.pool == this ? cur.self : nullptr;
+        }
+
+        __pool_task *find_task(worker *self)
+        {
+            if (self)
+            {
+                if (__pool_task *task = self->deque.take()) return task;
+            }
+
+            const size_t n = workers_.size();
+            uint64_t seed = self ? self->seed : reinterpret_cast<uintptr_t>(&seed) | 1;
+            for (size_t attempt = 0; attempt < n; ++attempt)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+
+                worker *victim = workers_[seed % n];
+                if (victim == self) continue;
+                if (__pool_task *task = victim->deque.steal()) return task;
+            }
+
+            if (self) self->seed = seed;
+
+            std::unique_lock lock(injected_mutex_);
+            if (!injected_.empty()) return injected_.pop_back_move();
+            return nullptr;
+        }
+
+        void run_worker(worker *self)
+        {
+            current() = current_worker{this, self};
+
+            while (true)
+            {
+                if (run_one(self)) continue;
+
+                // Spin briefly before parking
+                bool found = false;
+                for (int i = 0; i < 64 && !found; ++i)
+                {
+                    std::this_thread::yield();
+                    found = pending_.load(std::memory_order_relaxed) != 0;
+                }
+
+                if (found) continue;
+
+                std::unique_lock lock(sleep_mutex_);
+                sleeping_.fetch_add(1, std::memory_order_seq_cst);
+                wake_.wait(lock, [this] {
+                    return stop_.load(std::memory_order_relaxed) || pending_.load(std::memory_order_seq_cst) != 0;
+                });
+                sleeping_.fetch_sub(1, std::memory_order_relaxed);
+
+                if (stop_.load(std::memory_order_relaxed) && pending_.load(std::memory_order_relaxed) == 0) return;
+            }
+        }
+
+        bool run_one(worker *self)
+        {
+            __pool_task *task = find_task(self);
+            if (!task) return false;
+
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            task->execute(task);
+            return true;
+        }
+
+        void notify()
+        {
+            if (sleeping_.load(std::memory_order_seq_cst) != 0)
+            {
+                std::unique_lock lock(sleep_mutex_);
+                wake_.notify_one();
+            }
+        }
+
+    public:
+        /**
+         * \brief Starts a pool.
+         *
+         * \param threads Number of worker threads, 0 for one per hardware thread.
+         */
+        explicit thread_pool(size_t threads = 0)
+        {
+            if (threads == 0) threads = std::thread::hardware_concurrency();
+            if (threads == 0) threads = 1;
+
+            for (size_t i = 0; i < threads; ++i)
+            {
+                workers_.push_back(new worker{{}, 0x9E3779B97F4A7C15ull * (i + 1)});
+            }
+
+            for (size_t i = 0; i < threads; ++i)
+            {
+                worker *self = workers_[i];
+                threads_.emplace_back([this, self] { run_worker(self); });
+            }
+        }
+
+        thread_pool(const thread_pool &) = delete;
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        /// Process-wide pool with one worker per hardware thread, started on first use
+        static thread_pool &global()
+        {
+            static thread_pool pool;
+            return pool;
+        }
+
+        /**
+         * \brief Queues a task; workers push to their own deque, other threads to the injection queue.
+         */
+        void submit(__pool_task *task)
+        {
+            if (worker *self = local_worker())
+            {
+                self->deque.push(task);
+            }
+            else
+            {
+                std::unique_lock lock(injected_mutex_);
+                injected_.push_back(task);
+            }
+
+            pending_.fetch_add(1, std::memory_order_seq_cst);
+            notify();
+        }
+
+        /**
+         * \brief Runs one queued task on the calling thread, if there is one.
+         *
+         * \return Whether a task was run.
+         */
+        bool try_run_one()
+        {
+            return run_one(local_worker());
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return workers_.size();
+        }
+
+        ~thread_pool()
+        {
+            {
+                std::unique_lock lock(sleep_mutex_);
+                stop_.store(true, std::memory_order_relaxed);
+            }
+
+            wake_.notify_all();
+            for (auto &thread : threads_) thread.join();
+            for (worker *w : workers_) delete w;
+        }
+    };
+
+    /**
+     * \brief Set of tasks that can be waited on together.
+     *
+     * wait() runs queued tasks on the calling thread until every task of the
+     * group has finished, then rethrows the first exception any of them threw.
+     */
+    class task_group
+    {
+        template <typename F>
+        struct closure : __pool_task
+        {
+            F fn;
+            task_group *group;
+
+            closure(F &&f, task_group *g)
+                : __pool_task{&closure::run}, fn(stl::move(f)), group(g)
+            {}
+
+            static void run(__pool_task *task)
+            {
+                auto *self = static_cast<closure *>(task);
+                task_group *group = self->group;
+
+                try
+                {
+                    self->fn();
+                }
+                catch (...)
+                {
+                    group->fail(std::current_exception());
+                }
+
+                delete self;
+                group->pending_.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        };
+
+        thread_pool &pool_;
+        std::atomic<size_t> pending_ = 0;
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+
+        void fail(std::exception_ptr error)
+        {
+            std::unique_lock lock(error_mutex_);
+            if (!error_) error_ = stl::move(error);
+        }
+
+    public:
+        explicit task_group(thread_pool &pool = thread_pool::global())
+            : pool_(pool)
+        {}
+
+        task_group(const task_group &) = delete;
+        task_group &operator=(const task_group &) = delete;
+
+        /**
+         * \brief Queues fn() on the pool.
+         */
+        template <typename F>
+        void run(F fn)
+        {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            pool_.submit(new closure<F>(stl::move(fn), this));
+        }
+
+        /**
+         * \brief Waits for every task, helping with queued work meanwhile.
+         *
+         * \throws The first exception thrown by a task of the group.
+         */
+        void wait()
+        {
+            while (pending_.load(std::memory_order_acquire) != 0)
+            {
+                if (!pool_.try_run_one()) std::this_thread::yield();
+            }
+
+            if (error_)
+            {
+                std::exception_ptr error = stl::move(error_);
+                error_ = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+        [[nodiscard]] thread_pool &pool() const
+        {
+            return pool_;
+        }
+
+        ~task_group()
+        {
+            while (pending_.load(std::memory_order_acquire) != 0)
+            {
+                if (!pool_.try_run_one()) std::this_thread::yield();
+            }
+        }
+    };
+}
@@ -30,6 +30,7 @@
 #pragma once
 #include "display.h"
 #include "owned_string.h"
+#include "zelix/algorithm/ftoi.h"
 #include "zelix/algorithm/itoa.h"
 
 namespace zelix::stl
@@ -73,6 +74,14 @@ namespace zelix::stl
         {
             return algorithm::itoa(val);
         }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            return algorithm::dtoa(val);
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            return algorithm::ftoa(val);
+        }
         else
         {
             static_assert(false,
@@ -31,4 +31,6 @@
 
 // This is just a placeholder file that includes
 // All trie implementations
-#include "alphabetic_trie.h"
\ No newline at end of file
+#include "alphabetic_trie.h"
+#include "double_array_trie.h"
+#include "radix_trie.h"
@@ -32,6 +32,8 @@
 #include "zelix/memory/monotonic.h"
 #include "zelix/memory/resource.h"
 #include "zelix/memory/system_resource.h"
+#include "zelix/memory/thread_cache.h"
+#include "zelix/relocatable.h"
 
 namespace zelix::stl
 {
@@ -45,7 +47,7 @@ namespace zelix::stl
                 memory::system_array_resource<T>,
                 std::conditional_t<
                     ConcurrentAllocation,
-                    memory::concurrent_monotonic_resource<T>,
+                    memory::thread_cached_resource<T>,
                     memory::monotonic_resource<T>
                 >
             >,
@@ -152,6 +154,9 @@ namespace zelix::stl
         };
     }
 
+    template <typename T, bool ConcurrentAllocation, typename Allocator, typename E>
+    struct is_trivially_relocatable<pmr::unique_ptr<T, ConcurrentAllocation, Allocator, E>> : std::true_type {};
+
     template <typename T>
     using unique_ptr = pmr::unique_ptr<T, false>; ///< Non-concurrent unique pointer
 
@@ -0,0 +1,463 @@
+/*
+        ==== The Zelix Programming Language ====
+---------------------------------------------------------
+  - This file is part of the Zelix Programming Language
+    codebase. Zelix is a fast, statically-typed and
+    memory-safe programming language that aims to
+    match native speeds while staying highly performant.
+---------------------------------------------------------
+  - Zelix is categorized as free software; you can
+    redistribute it and/or modify it under the terms of
+    the GNU General Public License as published by the
+    Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+---------------------------------------------------------
+  - Zelix is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even
+    the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public
+    License for more details.
+---------------------------------------------------------
+  - You should have received a copy of the GNU General
+    Public License along with Zelix. If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+//
+// Created by rodrigo on 10/14/25.
+//
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "forward.h"
+#include "move.h"
+#include "zelix/except/out_of_range.h"
+#include "zelix/memory/resource.h"
+#include "zelix/memory/system_resource.h"
+
+namespace zelix::stl
+{
+    namespace pmr
+    {
+        /**
+         * @brief Node of an unrolled_list, holding up to Capacity elements.
+         *
+         * Live elements occupy [begin, end) of the storage, so both ends can
+         * grow without shifting. Elements are constructed and destroyed by the
+         * list, the node itself only owns raw storage.
+         */
+        template <typename T, size_t Capacity>
+        struct __unrolled_node
+        {
+            alignas(T) unsigned char storage[Capacity * sizeof(T)];
+            uint32_t begin = 0; ///< Index of the first live element
+            uint32_t end = 0; ///< Index past the last live element
+            __unrolled_node *next = nullptr;
+            __unrolled_node *prev = nullptr;
+
+            __unrolled_node() = default;
+
+            explicit __unrolled_node(const uint32_t start)
+                : begin(start), end(start)
+            {}
+
+            T *elements()
+            {
+                return reinterpret_cast<T *>(storage);
+            }
+
+            [[nodiscard]] size_t count() const
+            {
+                return end - begin;
+            }
+        };
+
+        /// Default number of elements per node: about 512 bytes of payload, clamped to [32, 64]
+        template <typename T>
+        inline constexpr size_t __unrolled_default_capacity =
+            512 / sizeof(T) < 32 ? 32 : 512 / sizeof(T) > 64 ? 64 : 512 / sizeof(T);
+
+        /**
+         * @brief Double-ended list storing many elements per node.
+         *
+         * Offers the delist API, but each node holds up to NodeCapacity
+         * contiguous elements, so pushes and pops only allocate once per node
+         * and iteration walks arrays instead of chasing a pointer per element.
+         * Nodes come from the system allocator by default, so independent
+         * lists are safe to use from different threads.
+         *
+         * @tparam T Type of the stored value.
+         * @tparam NodeCapacity Maximum number of elements per node.
+         * @tparam Allocator Allocator type for node management.
+         */
+        template <
+            typename T,
+            size_t NodeCapacity = __unrolled_default_capacity<T>,
+            typename Allocator = memory::system_resource<__unrolled_node<T, NodeCapacity>>,
+            typename = std::enable_if_t<
+                std::is_base_of_v<memory::resource<__unrolled_node<T, NodeCapacity>>, Allocator>
+            >
+        >
+        class unrolled_list
+        {
+            using node = __unrolled_node<T, NodeCapacity>;
+            static_assert(NodeCapacity > 0 && NodeCapacity <= UINT32_MAX, "Node capacity out of range");
+
+            size_t len = 0;
+            node *head = nullptr;
+            node *tail = nullptr;
+
+            /// Unlinks an empty node and returns it to the allocator
+            void release(node *n)
+            {
+                if (n->prev) n->prev->next = n->next;
+                else head = n->next;
+
+                if (n->next) n->next->prev = n->prev;
+                else tail = n->prev;
+
+                Allocator::deallocate(n);
+            }
+
+            /// Finds the node holding the element at index, storing its offset within the node
+            node *locate(size_t index, size_t &offset) const
+            {
+                // Walk from whichever end is closer
+                if (index < len / 2)
+                {
+                    node *current = head;
+                    while (index >= current->count())
+                    {
+                        index -= current->count();
+                        current = current->next;
+                    }
+
+                    offset = current->begin + index;
+                    return current;
+                }
+
+                size_t back = len - 1 - index;
+                node *current = tail;
+                while (back >= current->count())
+                {
+                    back -= current->count();
+                    current = current->prev;
+                }
+
+                offset = current->end - 1 - back;
+                return current;
+            }
+
+        public:
+            /**
+             * @brief Forward iterator over the elements in order.
+             */
+            class iterator
+            {
+                node *current;
+                size_t index;
+
+                friend class unrolled_list;
+
+                iterator(node *n, const size_t i)
+                    : current(n), index(i)
+                {}
+
+            public:
+                T &operator*() const
+                {
+                    return current->elements()[index];
+                }
+
+                T *operator->() const
+                {
+                    return &current->elements()[index];
+                }
+
+                iterator &operator++()
+                {
+                    if (++index == current->end)
+                    {
+                        current = current->next;
+                        index = current ? current->begin : 0;
+                    }
+
+                    return *this;
+                }
+
+                bool operator==(const iterator &other) const
+                {
+                    return current == other.current && index == other.index;
+                }
+
+                bool operator!=(const iterator &other) const
+                {
+                    return !(*this == other);
+                }
+            };
+
+            unrolled_list() = default;
+            unrolled_list(const unrolled_list &) = delete;
+            unrolled_list &operator=(const unrolled_list &) = delete;
+
+            unrolled_list(unrolled_list &&other) noexcept
+                : len(other.len), head(other.head), tail(other.tail)
+            {
+                other.len = 0;
+                other.head = nullptr;
+                other.tail = nullptr;
+            }
+
+            unrolled_list &operator=(unrolled_list &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    clear();
+                    len = other.len;
+                    head = other.head;
+                    tail = other.tail;
+                    other.len = 0;
+                    other.head = nullptr;
+                    other.tail = nullptr;
+                }
+
+                return *this;
+            }
+
+            /**
+             * @brief Insert an element at the front of the list.
+             * @param value Value to insert.
+             */
+            void push_front(T value)
+            {
+                emplace_front(stl::move(value));
+            }
+
+            /**
+             * @brief Insert an element at the back of the list.
+             * @param value Value to insert.
+             */
+            void push_back(T value)
+            {
+                emplace_back(stl::move(value));
+            }
+
+            /**
+             * @brief Construct and insert an element at the front of the list.
+             * @tparam Args Argument types for the element constructor.
+             * @param args Arguments to forward to the element constructor.
+             */
+            template <typename ... Args>
+            void emplace_front(Args&&... args)
+            {
+                if (!head || head->begin == 0)
+                {
+                    // Start the new node full of room on the left
+                    node *n = Allocator::allocate(static_cast<uint32_t>(NodeCapacity));
+                    n->next = head;
+                    if (head) head->prev = n;
+                    head = n;
+                    if (!tail) tail = n; // First node
+                }
+
+                new (&head->elements()[head->begin - 1]) T(stl::forward<Args>(args)...);
+                --head->begin;
+                len++;
+            }
+
+            /**
+             * @brief Construct and insert an element at the back of the list.
+             * @tparam Args Argument types for the element constructor.
+             * @param args Arguments to forward to the element constructor.
+             */
+            template <typename ... Args>
+            void emplace_back(Args&&... args)
+            {
+                if (!tail || tail->end == NodeCapacity)
+                {
+                    node *n = Allocator::allocate(static_cast<uint32_t>(0));
+                    n->prev = tail;
+                    if (tail) tail->next = n;
+                    tail = n;
+                    if (!head) head = n; // First node
+                }
+
+                new (&tail->elements()[tail->end]) T(stl::forward<Args>(args)...);
+                ++tail->end;
+                len++;
+            }
+
+            /**
+             * @brief Remove the element at the front of the list.
+             *        Does nothing if the list is empty.
+             */
+            void pop_front()
+            {
+                if (!head) return; // Empty list
+                len--;
+                head->elements()[head->begin].~T();
+                if (++head->begin == head->end) release(head);
+            }
+
+            /**
+             * @brief Remove the element at the back of the list.
+             *        Does nothing if the list is empty.
+             */
+            void pop_back()
+            {
+                if (!tail) return; // Empty list
+                len--;
+                tail->elements()[--tail->end].~T();
+                if (tail->begin == tail->end) release(tail);
+            }
+
+            /**
+             * @brief Remove all elements from the list.
+             */
+            void clear()
+            {
+                while (head)
+                {
+                    node *next = head->next;
+                    if constexpr (!std::is_trivially_destructible_v<T>)
+                    {
+                        for (uint32_t i = head->begin; i < head->end; ++i)
+                        {
+                            head->elements()[i].~T();
+                        }
+                    }
+
+                    Allocator::deallocate(head);
+                    head = next;
+                }
+
+                tail = nullptr;
+                len = 0;
+            }
+
+            /**
+             * @brief Access the first element.
+             * @return Reference to the first element.
+             * @throws except::out_of_range if the list is empty.
+             */
+            T &front()
+            {
+                if (!head) throw except::out_of_range("Unrolled list is empty");
+                return head->elements()[head->begin];
+            }
+
+            /**
+             * @brief Access the last element.
+             * @return Reference to the last element.
+             * @throws except::out_of_range if the list is empty.
+             */
+            T &back()
+            {
+                if (!tail) throw except::out_of_range("Unrolled list is empty");
+                return tail->elements()[tail->end - 1];
+            }
+
+            /**
+             * @brief Access element by index.
+             * @param index Position of the element.
+             * @return Reference to the element at the given index.
+             * @throws except::out_of_range if index is out of bounds.
+             */
+            T &operator[](const size_t index)
+            {
+                if (index >= len) throw except::out_of_range("Index out of range");
+
+                size_t offset;
+                node *n = locate(index, offset);
+                return n->elements()[offset];
+            }
+
+            /**
+             * @brief Get the number of elements in the list.
+             * @return Number of elements.
+             */
+            [[nodiscard]] size_t size() const
+            {
+                return len;
+            }
+
+            /**
+             * @brief Check if the list is empty.
+             * @return True if empty, false otherwise.
+             */
+            [[nodiscard]] bool empty() const
+            {
+                return len == 0;
+            }
+
+            /**
+             * @brief Remove the element at the specified index.
+             * @param n The index of the element to remove.
+             * @throws except::out_of_range if the index is out of bounds.
+             */
+            void erase(const size_t n)
+            {
+                if (n >= len) throw except::out_of_range("Index out of range");
+
+                size_t offset;
+                node *current = locate(n, offset);
+                len--;
+                T *elements = current->elements();
+                elements[offset].~T();
+
+                // Close the gap from whichever side of the node is shorter
+                if (offset - current->begin < current->end - 1 - offset)
+                {
+                    for (size_t i = offset; i > current->begin; --i)
+                    {
+                        new (&elements[i]) T(stl::move(elements[i - 1]));
+                        elements[i - 1].~T();
+                    }
+
+                    ++current->begin;
+                }
+                else
+                {
+                    for (size_t i = offset; i + 1 < current->end; ++i)
+                    {
+                        new (&elements[i]) T(stl::move(elements[i + 1]));
+                        elements[i + 1].~T();
+                    }
+
+                    --current->end;
+                }
+
+                if (current->begin == current->end) release(current);
+            }
+
+            iterator begin()
+            {
+                return iterator(head, head ? head->begin : 0);
+            }
+
+            iterator end()
+            {
+                return iterator(nullptr, 0);
+            }
+
+            /**
+             * @brief Destructor. Clears the list and deallocates all nodes.
+             */
+            ~unrolled_list()
+            {
+                clear();
+            }
+        };
+    }
+
+    /**
+     * @brief Alias for pmr::unrolled_list using the default allocator.
+     * @tparam T Type of the stored value.
+     */
+    template <typename T>
+    using unrolled_list = pmr::unrolled_list<T>;
+}
@@ -30,10 +30,13 @@
 #pragma once
 #include <initializer_list>
 #include <type_traits>
+#include "span.h"
+#include "zelix/probe.h"
 #include "zelix/except/out_of_range.h"
 #include "zelix/except/uninitialized_memory.h"
 #include "zelix/memory/array_resource.h"
 #include "zelix/memory/system_resource.h"
+#include "zelix/relocatable.h"
 
 namespace zelix::stl
 {
@@ -61,7 +64,7 @@ namespace zelix::stl
         class vector
         {
             bool initialized_ = false; ///< Indicates if the internal storage has been initialized.
-            T* data;        ///< Pointer to the internal storage array.
+            T* data_;        ///< Pointer to the internal storage array.
             size_t size_ = 0;         ///< Number of elements currently stored.
             size_t capacity_;    ///< Current capacity of the internal storage.
 
@@ -73,7 +76,7 @@ namespace zelix::stl
             {
                 initialized_ = true;
                 capacity_ = InitialCapacity;
-                data = Allocator::allocate(capacity_);
+                data_ = Allocator::allocate(capacity_);
             }
 
             /**
@@ -81,19 +84,105 @@ namespace zelix::stl
              * Allocates new memory, moves existing elements, and releases old memory.
              * @param new_size The new capacity for the internal storage.
              */
-            void resize(const size_t new_size)
+            void set_capacity(const size_t new_size)
             {
-                if (!data)
+                ZELIX_STL_PROBE1(vector_regrow, new_size);
+                if (!data_)
                 {
-                    data = Allocator::allocate(new_size);
+                    data_ = Allocator::allocate(new_size);
                     capacity_ = new_size;
                     return;
                 }
 
-                data = Allocator::reallocate(data, size_, new_size);
+                data_ = Allocator::reallocate(data_, size_, new_size);
                 capacity_ = new_size;
             }
 
+            /**
+             * @brief Makes room for extra more elements with a single reallocation.
+             *
+             * Grows by GrowthFactor, or straight to the needed size when that is
+             * larger, so bulk insertions reallocate at most once.
+             * @param extra Number of elements about to be added.
+             */
+            void grow_for(const size_t extra)
+            {
+                const size_t needed = size_ + extra;
+                if (needed <= capacity_ && initialized_)
+                {
+                    return;
+                }
+
+                if (!initialized_)
+                {
+                    initialized_ = true;
+                    capacity_ = 0;
+                    data_ = nullptr;
+                    set_capacity(needed > InitialCapacity ? needed : InitialCapacity);
+                    return;
+                }
+
+                // Small capacities times the factor may truncate back to themselves
+                size_t grown = static_cast<size_t>(capacity_ * GrowthFactor);
+                if (grown <= capacity_) grown = capacity_ + 1;
+                set_capacity(grown > needed ? grown : needed);
+            }
+
+            /**
+             * @brief Moves [from, size_) to start at to, which may be on either side.
+             * The caller adjusts size_; the vacated slots are left unconstructed.
+             */
+            void shift_tail(const size_t from, const size_t to)
+            {
+                const size_t count = size_ - from;
+                if (count == 0 || from == to)
+                {
+                    return;
+                }
+
+                if constexpr (is_trivially_relocatable_v<T>)
+                {
+                    memmove(static_cast<void *>(data_ + to), data_ + from, sizeof(T) * count);
+                }
+                else if (to > from)
+                {
+                    for (size_t i = count; i-- > 0;)
+                    {
+                        new (&data_[to + i]) T(stl::move(data_[from + i]));
+                        data_[from + i].~T();
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        new (&data_[to + i]) T(stl::move(data_[from + i]));
+                        data_[from + i].~T();
+                    }
+                }
+            }
+
+            /// Copy-constructs [first, last) into the unconstructed slots at dst
+            template <typename It>
+            static void construct_range(T *dst, It first, It last)
+            {
+                if constexpr (
+                    std::is_pointer_v<It> &&
+                    std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T> &&
+                    std::is_trivially_copyable_v<T>
+                )
+                {
+                    if (first != last) memcpy(static_cast<void *>(dst), first, sizeof(T) * (last - first));
+                }
+                else
+                {
+                    for (; first != last; ++first, ++dst)
+                    {
+                        new (dst) T(*first);
+                    }
+                }
+            }
+
             /**
              * @brief Destroys all elements and releases memory.
              * Calls the destructor for each element and deallocates the internal storage.
@@ -107,13 +196,44 @@ namespace zelix::stl
                     {
                         for (size_t i = 0; i < size_; ++i)
                         {
-                            data[i].~T(); // Call destructor for each element
+                            data_[i].~T(); // Call destructor for each element
                         }
                     }
 
                     aggressive_destroy(); // Deallocate memory
                 }
             }
+
+            /**
+             * @brief Throws unless index refers to a constructed element.
+             *
+             * An uninitialized vector has size 0, so one comparison covers both
+             * cases on the hot path; telling them apart is left to the cold path.
+             */
+            void check_index(const size_t index) const
+            {
+#           if defined(__GNUC__) || defined(__clang__)
+                if (__builtin_expect(index >= size_, 0))
+#           else
+                if (index >= size_)
+#           endif
+                {
+                    index_error();
+                }
+            }
+
+#           if defined(__GNUC__) || defined(__clang__)
+            [[noreturn]] __attribute__((cold, noinline))
+#           else
+            [[noreturn]]
+#           endif
+            void index_error() const
+            {
+                if (!initialized_)
+                    throw except::uninitialized_memory("Early access to vector");
+
+                throw except::out_of_range("Index out of range");
+            }
         public:
             /**
              * @brief Default constructor.
@@ -121,18 +241,18 @@ namespace zelix::stl
              * Asserts that GrowthFactor is greater than 1.0.
              */
             vector()
-                : initialized_(false), data(nullptr), size_(0), capacity_(10)
+                : initialized_(false), data_(nullptr), size_(0), capacity_(10)
             {
                 static_assert(GrowthFactor > 1.0, "Growth factor must be greater than 1.0");
             }
 
             vector(vector&& other) noexcept
                 : initialized_(other.initialized_)
-                , data(other.data)
+                , data_(other.data_)
                 , size_(other.size_)
                 , capacity_(other.capacity_)
             {
-                other.data = nullptr;
+                other.data_ = nullptr;
                 other.initialized_ = false;
                 other.size_ = 0;
                 other.capacity_ = 0;
@@ -140,11 +260,11 @@ namespace zelix::stl
 
             vector(vector& other) noexcept
                 : initialized_(other.initialized_)
-                , data(other.data)
+                , data_(other.data_)
                 , size_(other.size_)
                 , capacity_(other.capacity_)
             {
-                other.data = nullptr;
+                other.data_ = nullptr;
                 other.initialized_ = false;
                 other.size_ = 0;
                 other.capacity_ = 0;
@@ -152,14 +272,11 @@ namespace zelix::stl
 
             vector(std::initializer_list<T> init)
                 : initialized_(false)
-                , data(nullptr)
+                , data_(nullptr)
                 , size_(0)
                 , capacity_(0)
             {
-                reserve(init.size());
-
-                for (auto &elem : init)
-                    emplace_back(stl::move(elem));
+                append(init.begin(), init.end());
             }
 
 
@@ -172,24 +289,24 @@ namespace zelix::stl
                     size_ = other.size_;
                     capacity_ = other.capacity_;
 
-                    if (other.data)
+                    if (other.data_)
                     {
-                        data = Allocator::allocate(capacity_);
+                        data_ = Allocator::allocate(capacity_);
                         if constexpr (std::is_trivially_copyable_v<T>)
                         {
-                            memcpy(data, other.data, sizeof(T) * size_);
+                            memcpy(data_, other.data_, sizeof(T) * size_);
                         }
                         else
                         {
                             for (size_t i = 0; i < size_; ++i)
                             {
-                                new (&data[i]) T(other.data[i]);
+                                new (&data_[i]) T(other.data_[i]);
                             }
                         }
                     }
                     else
                     {
-                        data = nullptr;
+                        data_ = nullptr;
                     }
                 }
 
@@ -238,21 +355,192 @@ namespace zelix::stl
 
                 if (size_ >= capacity_)
                 {
-                    resize(static_cast<size_t>(capacity_ * GrowthFactor));
+                    grow_for(1);
                 }
 
                 if constexpr (std::is_trivially_copyable_v<T>)
                 {
                     auto val = T(stl::forward<Args>(args)...);
-                    data[size_] = val;
+                    data_[size_] = val;
                 }
                 else
                 {
-                    new (&this->data[size_]) T(stl::forward<Args>(args)...);
+                    new (&this->data_[size_]) T(stl::forward<Args>(args)...);
                 }
                 ++size_;
             }
 
+            /**
+             * @brief Constructs an element in-place at the end without checking capacity.
+             *
+             * For hot loops after a reserve(): the vector must already be
+             * initialized and have room for one more element.
+             *
+             * @tparam Args Argument types for T's constructor.
+             * @param args Arguments to forward to T's constructor.
+             */
+            template <typename... Args>
+            void emplace_back_unchecked(Args&&... args)
+            {
+                new (&data_[size_]) T(stl::forward<Args>(args)...);
+                ++size_;
+            }
+
+            /**
+             * @brief Appends copies of the elements in [first, last).
+             *
+             * Reserves once when the distance is known and memcpy's contiguous
+             * trivially copyable input. The range must not point into this vector.
+             *
+             * @param first Iterator to the first element to copy.
+             * @param last Iterator past the last element to copy.
+             */
+            template <typename It>
+            void append(It first, It last)
+            {
+                if constexpr (requires { last - first; })
+                {
+                    const auto n = static_cast<size_t>(last - first);
+                    if (n == 0)
+                    {
+                        return;
+                    }
+
+                    grow_for(n);
+                    construct_range(data_ + size_, first, last);
+                    size_ += n;
+                }
+                else
+                {
+                    for (; first != last; ++first)
+                    {
+                        emplace_back(*first);
+                    }
+                }
+            }
+
+            /**
+             * @brief Appends copies of every element of range.
+             *
+             * @param range Anything with begin() and end(), not this vector.
+             */
+            template <typename Range>
+            void append_range(const Range &range)
+            {
+                append(range.begin(), range.end());
+            }
+
+            /**
+             * @brief Inserts copies of [first, last) before index pos.
+             *
+             * Reserves once and shifts the tail a single time; relocatable
+             * elements are shifted with memmove. The range must not point into
+             * this vector.
+             *
+             * @param pos Index to insert at, at most size().
+             * @param first Iterator to the first element to copy.
+             * @param last Iterator past the last element to copy.
+             * @throws except::out_of_range If pos is past the end.
+             */
+            template <typename It>
+            void insert(const size_t pos, It first, It last)
+            {
+                if (pos > size_)
+                    throw except::out_of_range("Insert position out of range");
+
+                size_t n = 0;
+                if constexpr (requires { last - first; })
+                {
+                    n = static_cast<size_t>(last - first);
+                }
+                else
+                {
+                    for (It it = first; it != last; ++it)
+                    {
+                        ++n;
+                    }
+                }
+
+                if (n == 0)
+                {
+                    return;
+                }
+
+                grow_for(n);
+                shift_tail(pos, pos + n);
+                construct_range(data_ + pos, first, last);
+                size_ += n;
+            }
+
+            /**
+             * @brief Inserts copies of every element of range before index pos.
+             *
+             * @param pos Index to insert at, at most size().
+             * @param range Anything with begin() and end(), not this vector.
+             * @throws except::out_of_range If pos is past the end.
+             */
+            template <typename Range>
+            void insert_range(const size_t pos, const Range &range)
+            {
+                insert(pos, range.begin(), range.end());
+            }
+
+            /**
+             * @brief Grows or shrinks the vector to n elements.
+             *
+             * New elements are copies of value; removed ones are destroyed.
+             * @param n The new number of elements.
+             * @param value Element to copy into new slots.
+             */
+            void resize(const size_t n, const T &value)
+            {
+                ZELIX_STL_PROBE1(vector_resize, n);
+                if (n <= size_)
+                {
+                    if constexpr (!std::is_trivially_destructible_v<T>)
+                    {
+                        for (size_t i = n; i < size_; ++i)
+                        {
+                            data_[i].~T();
+                        }
+                    }
+
+                    size_ = n;
+                    return;
+                }
+
+                if (n > capacity_ || !initialized_)
+                {
+                    // value may live in the buffer that growing releases
+                    const T copy(value);
+                    grow_for(n - size_);
+                    for (size_t i = size_; i < n; ++i)
+                    {
+                        new (&data_[i]) T(copy);
+                    }
+
+                    size_ = n;
+                    return;
+                }
+
+                for (size_t i = size_; i < n; ++i)
+                {
+                    new (&data_[i]) T(value);
+                }
+
+                size_ = n;
+            }
+
+            /**
+             * @brief Grows or shrinks the vector to n elements, value-initializing new ones.
+             *
+             * @param n The new number of elements.
+             */
+            void resize(const size_t n)
+            {
+                resize(n, T());
+            }
+
             /**
              * @brief Removes the last element from the vector.
              * Calls the destructor for the last element and decreases the size.
@@ -266,14 +554,14 @@ namespace zelix::stl
 #           endif
                 {
                     --size_;
-                    data[size_].~T(); // Call destructor explicitly
+                    data_[size_].~T(); // Call destructor explicitly
 
                     // Free memory if we reached 0 elements
                     if (size_ == 0 && initialized_)
                     {
                         destroy();
                         initialized_ = false;
-                        data = nullptr;
+                        data_ = nullptr;
                         capacity_ = 0;
                     }
                 }
@@ -291,7 +579,7 @@ namespace zelix::stl
             T pop_back_move()
             {
                 --size_;
-                return stl::move(data[size_]);
+                return stl::move(data_[size_]);
             }
 
             /**
@@ -305,7 +593,7 @@ namespace zelix::stl
                 {
                     for (size_t i = 0; i < size_; ++i)
                     {
-                        data[i].~T();
+                        data_[i].~T();
                     }
                 }
 
@@ -319,7 +607,7 @@ namespace zelix::stl
              */
             T* begin()
             {
-                return data;
+                return data_;
             }
 
             /**
@@ -329,7 +617,7 @@ namespace zelix::stl
              */
             T* end()
             {
-                return data + size_;
+                return data_ + size_;
             }
 
             /**
@@ -339,7 +627,7 @@ namespace zelix::stl
              */
             [[nodiscard]] const T* begin() const
             {
-                return data;
+                return data_;
             }
 
             /**
@@ -349,7 +637,7 @@ namespace zelix::stl
              */
             [[nodiscard]] const T* end() const
             {
-                return data + size_;
+                return data_ + size_;
             }
 
             /**
@@ -369,13 +657,13 @@ namespace zelix::stl
 
                     // Move resources from other
                     this->initialized_ = other.initialized_;
-                    this->data = other.data;
+                    this->data_ = other.data_;
                     this->size_ = other.size_;
                     this->capacity_ = other.capacity_;
 
                     // Reset the other vector
                     other.initialized_ = false;
-                    other.data = nullptr;
+                    other.data_ = nullptr;
                     other.size_ = 0;
                     other.capacity_ = 0;
                 }
@@ -390,20 +678,14 @@ namespace zelix::stl
              * @return T& Reference to the element.
              * @throws except::exception If accessed before initialization.
              * @throws except::exception If index is out of bounds.
+             * @note Unchecked when built with ZELIX_STL_UNCHECKED.
              */
             T &operator[](size_t index)
             {
-#           if defined(__GNUC__) || defined(__clang__)
-                if (__builtin_expect(initialized_ == 0, 0))
-#           else
-                if (!initialized_)
+#           ifndef ZELIX_STL_UNCHECKED
+                check_index(index);
 #           endif
-                    throw except::uninitialized_memory("Early access to vector");
-
-                if (index >= size_)
-                    throw except::out_of_range("Index out of range");
-
-                return data[index];
+                return data_[index];
             }
 
             /**
@@ -413,20 +695,14 @@ namespace zelix::stl
              * @return T& Reference to the element.
              * @throws except::exception If accessed before initialization.
              * @throws except::exception If index is out of bounds.
+             * @note Unchecked when built with ZELIX_STL_UNCHECKED.
              */
             T &operator[](size_t index) const
             {
-#           if defined(__GNUC__) || defined(__clang__)
-                if (__builtin_expect(initialized_ == 0, 0))
-#           else
-                if (!initialized_)
+#           ifndef ZELIX_STL_UNCHECKED
+                check_index(index);
 #           endif
-                    throw except::uninitialized_memory("Early access to vector");
-
-                if (index >= size_)
-                    throw except::out_of_range("Index out of range");
-
-                return data[index];
+                return data_[index];
             }
 
             /**
@@ -476,7 +752,73 @@ namespace zelix::stl
              */
             T *ptr()
             {
-                return data;
+                return data_;
+            }
+
+            /**
+             * @brief Returns a pointer to the internal data.
+             *
+             * @return T* Pointer to data, nullptr before the first insertion.
+             */
+            T *data()
+            {
+                return data_;
+            }
+
+            /**
+             * @brief Returns a pointer to the internal data (const overload).
+             *
+             * @return const T* Pointer to data, nullptr before the first insertion.
+             */
+            [[nodiscard]] const T *data() const
+            {
+                return data_;
+            }
+
+            /**
+             * @brief Accesses the element at the given index without any checks.
+             *
+             * @param index Index of the element, must be below size().
+             * @return T& Reference to the element.
+             */
+            T &unchecked_at(const size_t index)
+            {
+                return data_[index];
+            }
+
+            /**
+             * @brief Accesses the element at the given index without any checks (const overload).
+             *
+             * @param index Index of the element, must be below size().
+             * @return const T& Reference to the element.
+             */
+            [[nodiscard]] const T &unchecked_at(const size_t index) const
+            {
+                return data_[index];
+            }
+
+            /**
+             * @brief Returns a span over the elements.
+             *
+             * Indexing a span is unchecked and its pointer and length are
+             * loop-invariant, so hot loops over it can be vectorized. It is
+             * invalidated by anything that reallocates the vector.
+             *
+             * @return span<T> View of [0, size()).
+             */
+            span<T> view()
+            {
+                return {data_, size_};
+            }
+
+            /**
+             * @brief Returns a read-only span over the elements.
+             *
+             * @return span<const T> View of [0, size()).
+             */
+            [[nodiscard]] span<const T> view() const
+            {
+                return {data_, size_};
             }
 
             /**
@@ -487,7 +829,7 @@ namespace zelix::stl
             {
                 if (size_ < capacity_)
                 {
-                    resize(size_);
+                    set_capacity(size_);
                 }
             }
 
@@ -498,10 +840,13 @@ namespace zelix::stl
              */
             void reserve(const size_t new_capacity)
             {
-                if (new_capacity > capacity_)
+                if (!initialized_)
                 {
-                    resize(new_capacity);
-                    initialized_ = true;
+                    grow_for(new_capacity);
+                }
+                else if (new_capacity > capacity_)
+                {
+                    set_capacity(new_capacity);
                 }
             }
 
@@ -514,17 +859,8 @@ namespace zelix::stl
              */
             T &ref_at(const size_t index)
             {
-#           if defined(__GNUC__) || defined(__clang__)
-                if (__builtin_expect(initialized_ == 0, 0))
-#           else
-                if (!initialized_)
-#           endif
-                    throw except::uninitialized_memory("Early access to vector");
-
-                if (index >= size_)
-                    throw except::out_of_range("Index out of range");
-
-                return data[index];
+                check_index(index);
+                return data_[index];
             }
 
             /**
@@ -534,7 +870,7 @@ namespace zelix::stl
              */
             T& back() {
                 if (size_ == 0) throw except::out_of_range("back() on empty vector");
-                return data[size_ - 1];
+                return data_[size_ - 1];
             }
 
             /**
@@ -589,13 +925,13 @@ namespace zelix::stl
              */
             void aggressive_destroy()
             {
-                if (!initialized_ || !data)
+                if (!initialized_ || !data_)
                 {
                     return;
                 }
 
-                Allocator::deallocate(data); // Deallocate memory
-                data = nullptr;
+                Allocator::deallocate(data_); // Deallocate memory
+                data_ = nullptr;
                 initialized_ = false;
             }
 
@@ -609,6 +945,9 @@ namespace zelix::stl
         };
     }
 
+    template <typename T, double GrowthFactor, size_t InitialCapacity, typename Allocator, typename E>
+    struct is_trivially_relocatable<pmr::vector<T, GrowthFactor, InitialCapacity, Allocator, E>> : std::true_type {};
+
     template <typename T, double GrowthFactor = 1.8, size_t InitialCapacity = 25>
     using vector = pmr::vector<T, GrowthFactor, InitialCapacity, memory::system_array_resource<T>>; ///< Default vector type using the default allocator
 }
\ No newline at end of file